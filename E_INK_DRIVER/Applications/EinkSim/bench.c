@@ -0,0 +1,227 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: bench.c
+//                  Driver benchmark on the host simulator (EinkSim)
+//                          Author: Sonikku
+//
+//              Runs the driver and graphics entry points against the controller model and writes one CSV line per
+//              case, so two runs (before / after a change) can be compared with diff or a spreadsheet:
+//
+//              case            - what was run
+//              spi_bytes       - bytes clocked to the controller        commands - of which commands
+//              pin_writes      - port / USCI register writes by the transport
+//              busy_waits      - BUSY waits that had to sleep           busy_ms  - modeled time asleep
+//              cycles          - estimated MSP430 cycles in the transport (see hal.c for the per byte costs), for
+//                                FlipBlock_text_row the FlipBlock cost from cycles.sh (FLIP_BLOCK_CYCLES). Empty,
+//                                with the ms_* columns, where there is no model: the rendering cases (OutString,
+//                                BlitString) and FlipBlock_text_row without FLIP_BLOCK_CYCLES
+//              ms_1mhz/16mhz   - cycles at that MCLK plus busy_ms
+//              ms_scaled       - the same with ClockFast / ClockSlow as the driver uses them (16 / 2 MHz, clock.h)
+//              saved_bytes     - commands and parameters the register shadow didn't send (DRIVER_STATS)
+//              saved_waits     - BUSY waits it didn't do
+//              host_us         - host CPU time of the call; only meaningful relative to another run on the same PC,
+//                                but the only number here that covers rendering (OutString, BlitString, ...)
+//
+//              Build:  cc -m32 -fcommon -O2 -DDRIVER_STATS -I. -I../.. -o einkbench bench.c ssd16xx.c hal.c
+//                          ../../display_driver.c ../../graphlib.c ../../displist.c ../../timer.c ../../clock.c
+//                      Add -DHARDWARE_SCROLL for the ScrollDisplay cases
+//                      Add -DFLIP_BLOCK_CYCLES=$(sh cycles.sh FlipBlock ../../graphlib.c) with an MSP430 clang
+//              Usage:  einkbench [-t gpio|usci]  >  before.csv
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <msp430.h>
+#include "disp_driver.h"
+#include "graphlib.h"
+#include "displist.h"
+#include "timer.h"
+#include "clock.h"
+#include "stdfonts.h"
+#include "ssd16xx.h"
+#include "hal.h"
+
+#ifndef DRIVER_STATS
+#error "Build einkbench with -DDRIVER_STATS, for the saved_bytes and saved_waits columns"
+#endif
+
+// Run one case and print its line; BENCH_UNMODELLED leaves the cycle and ms_* columns empty
+#define BENCH(name, call)               {Snapshot snap; TakeSnapshot(&snap); call; Report(name, &snap, 1);}
+#define BENCH_UNMODELLED(name, call)    {Snapshot snap; TakeSnapshot(&snap); call; Report(name, &snap, 0);}
+
+typedef struct {
+    CtrlStats ctrl;
+    HalStats hal;
+    struct timespec host;
+} Snapshot;
+
+static unsigned char image_a[5000];
+static unsigned char image_b[5000];
+static unsigned char image_c[5000];
+
+static const DisplayCommand bench_list []={
+    {DL_TEXT,   0,   0,   0,  16, "  e-Ink DRIVER MSP430", Font2},
+    {DL_TEXT,   0,  16,   0,  16, "   Benchmark screen", Font2},
+    {DL_BOX,    2,  40, 196, 100, 0, 0},
+    {DL_LINE,   2,  40, 197, 139, 0, 0},
+    {DL_BAR,    8, 150, 184,   8, 0, 0},
+    {DL_TEXT,   0, 168,   0,  16, "  0123456789 ABCDEF", Font2},
+    {DL_END,    0,   0,   0,   0, 0, 0}
+};
+
+static const char bench_text[] = "The quick brown fox 0123";
+
+// Shadow counters in display_driver.c. StartDisplayFrame latches and clears them, so they are cleared before each case
+// and the case's savings are the latched ones plus those since. No case starts more than one refresh
+extern unsigned int saved_bytes;
+extern unsigned int saved_waits;
+extern unsigned int frame_saved_bytes;
+extern unsigned int frame_saved_waits;
+
+static void TakeSnapshot(Snapshot *snap){
+    saved_bytes = 0;
+    saved_waits = 0;
+    frame_saved_bytes = 0;
+    frame_saved_waits = 0;
+    snap->ctrl = ctrl_stats;
+    snap->hal = hal_stats;
+    clock_gettime(CLOCK_MONOTONIC, &snap->host);
+}
+
+static void Report(const char *name, const Snapshot *snap, unsigned char modelled){
+    struct timespec now;
+    unsigned long cycles;
+    unsigned long slow_cycles;
+    double busy_ms;
+    double host_us;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    host_us = ((now.tv_sec - snap->host.tv_sec) * 1e6) + ((now.tv_nsec - snap->host.tv_nsec) / 1e3);
+    cycles = hal_stats.cycles - snap->hal.cycles;
+    slow_cycles = hal_stats.slow_cycles - snap->hal.slow_cycles;
+    busy_ms = (hal_stats.sleep_us - snap->hal.sleep_us) / 1000.0;
+
+    printf("%s,%lu,%lu,%lu,%lu,%.1f,", name,
+           ctrl_stats.bytes - snap->ctrl.bytes,
+           ctrl_stats.commands - snap->ctrl.commands,
+           hal_stats.pin_writes - snap->hal.pin_writes,
+           hal_stats.sleeps - snap->hal.sleeps,
+           busy_ms);
+    if (modelled){
+        printf("%lu,%.2f,%.2f,%.2f,", cycles,
+               (cycles / 1000.0) + busy_ms,
+               (cycles / 16000.0) + busy_ms,
+               ((cycles - slow_cycles) / (CLOCK_MCLK_FAST_HZ / 1000.0)) + (slow_cycles / (CLOCK_MCLK_SLOW_HZ / 1000.0)) + busy_ms);
+    } else {
+        printf(",,,,");
+    }
+    printf("%.1f,%u,%u\n", host_us,
+           frame_saved_bytes + saved_bytes,
+           frame_saved_waits + saved_waits);
+}
+
+// The flips LoadText does for one text row: one per 8 x 8 block
+static void FlipTextRow(void){
+    unsigned int n;
+
+    for (n = 0; n < (DISPLAY_X_SIZE / 8); n++){
+        FlipBlock(&frame_buffer[n * 8]);
+    }
+#ifdef FLIP_BLOCK_CYCLES
+    hal_stats.cycles += (DISPLAY_X_SIZE / 8) * FLIP_BLOCK_CYCLES;
+#endif
+}
+
+static void RenderText(const int *font){
+    InitFrameBuffer();
+    OutString(bench_text, font);
+}
+
+static void RenderBand(const int *font){
+    InitFrameBuffer();
+    BlitString(bench_text, font);
+}
+
+int main(int argc, char **argv){
+    unsigned int n;
+
+    if ((argc == 3) && (strcmp(argv[1], "-t") == 0) && (strcmp(argv[2], "usci") == 0)){
+        HalSetBackend(HAL_USCI);
+    } else if ((argc == 3) && (strcmp(argv[1], "-t") == 0) && (strcmp(argv[2], "gpio") == 0)){
+        HalSetBackend(HAL_GPIO);
+        HalSetByteTime(190);
+    } else if (argc != 1){
+        fprintf(stderr, "usage: einkbench [-t gpio|usci]\n");
+        return 1;
+    } else {
+        HalSetByteTime(190);                    // GPIO is the default transport
+    }
+
+    for (n = 0; n < sizeof(image_a); n++){
+        image_a[n] = ((n / 25) & 8) ? 0xF0 : 0x0F;              // Stripes
+        image_b[n] = image_a[n];
+    }
+    for (n = 2000; n < 2500; n++){
+        image_b[n] = 0xFF;                                      // 20 rows differ
+    }
+    memcpy(image_c, image_b, sizeof(image_c));
+    for (n = 2000; n < 2500; n++){
+        image_c[n] = 0x00;                                      // The same 20 rows differ again
+    }
+
+    CtrlReset();
+    InitClock();
+    InitDriver();
+    InitTimerSystem();
+    __enable_interrupt();
+
+    printf("case,spi_bytes,commands,pin_writes,busy_waits,busy_ms,cycles,ms_1mhz,ms_16mhz,ms_scaled,host_us,saved_bytes,saved_waits\n");
+
+    BENCH("InitDisplay", InitDisplay());
+    BENCH("BlankScreen", BlankScreen());
+    BENCH("DisplayFrame_full", DisplayFrame());
+    BENCH("BlankScreen_again", BlankScreen());
+    BENCH("DisplayFrame_full", DisplayFrame());
+    BENCH("LoadBitmap_new", LoadBitmap(image_a));
+    BENCH("DisplayFrame_full", DisplayFrame());
+    BENCH("LoadBitmap_first_bank", LoadBitmap(image_a));
+    BENCH("DisplayFrame_full", DisplayFrame());
+    BENCH("LoadBitmap_same", LoadBitmap(image_a));
+    BENCH("LoadBitmap_20_rows_changed", LoadBitmap(image_b));
+    BENCH("ShowImage_20_rows_changed", ShowImage(image_c));
+    BENCH("ShowImage_same", ShowImage(image_c));
+    BENCH("ShowImage_refresh", PollBusy());
+
+    BENCH_UNMODELLED("OutString_Font1", RenderText(Font1));
+    BENCH("LoadText_single", LoadText(0, 0, 0));
+    BENCH_UNMODELLED("OutString_Font2", RenderText(Font2));
+    BENCH("LoadText_double", LoadText(0, 16, 1));
+    BENCH_UNMODELLED("OutString_Font3", RenderText(Font3));
+    BENCH("LoadText_double", LoadText(0, 32, 1));
+#ifdef FLIP_BLOCK_CYCLES
+    BENCH("FlipBlock_text_row", FlipTextRow());
+#else
+    BENCH_UNMODELLED("FlipBlock_text_row", FlipTextRow());
+#endif
+
+    BENCH_UNMODELLED("BlitString_Font1", RenderBand(Font1));
+    BENCH_UNMODELLED("BlitString_Font2", RenderBand(Font2));
+    BENCH_UNMODELLED("BlitString_Font3", RenderBand(Font3));
+    BENCH("LoadBand", LoadBand(48, BAND_ROWS));
+
+    BENCH("RenderDisplayList", RenderDisplayList(bench_list));
+    BENCH("DisplayFrame_full", DisplayFrame());
+    BENCH("SetRefreshMode_partial", SetRefreshMode(REFRESH_PARTIAL));
+    BENCH("SetRefreshMode_partial_again", SetRefreshMode(REFRESH_PARTIAL));
+    BENCH("DisplayFrame_partial", DisplayFrame());
+    BENCH("DoDisplayTest", DoDisplayTest());
+    BENCH("DisplayFrame_partial", DisplayFrame());
+#ifdef HARDWARE_SCROLL
+    BENCH_UNMODELLED("BlitString_Font2", RenderBand(Font2));
+    BENCH("ScrollDisplay_16_rows", ScrollDisplay(16));
+    BENCH("ScrollDisplay_8_rows", ScrollDisplay(8));
+#endif
+
+    return ((ctrl_stats.busy_violations != 0) || (hal_stats.cs_errors != 0)) ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+#!/bin/sh
+#---------------------------------------------------------------------------------------------------------------------------
+#
+#                      Name: cycles.sh
+#                  MSP430 cycle count of a branch free function (EinkSim)
+#                          Author: Sonikku
+#
+#              Compiles a driver source for the MSP430 with clang, takes the named function from the assembly and
+#              adds up the cycles of its instructions from the MSP430x2xx family guide tables (format I by source and
+#              destination mode, format II, constant generator immediates as registers), plus 5 for the CALL #func
+#              that reaches it. Code without jumps runs every instruction once, so for such a function this is its
+#              exact cycle count as this compiler builds it; a function with jumps is refused. Code Composer's
+#              compiler allocates registers differently, so take the figure as close, not exact, for the target.
+#
+#              einkbench is built with it for the FlipBlock case:
+#                  cc ... -DFLIP_BLOCK_CYCLES=$(sh cycles.sh FlipBlock ../../graphlib.c) bench.c ...
+#
+#              Usage:  sh cycles.sh function source.c      (from this directory)
+#                      MSP430_CC may be set, default "clang --target=msp430 -O2"
+#---------------------------------------------------------------------------------------------------------------------------
+
+MSP430_CC=${MSP430_CC:-clang --target=msp430 -O2}
+
+if [ $# -ne 2 ]; then
+    echo "usage: sh cycles.sh function source.c" >&2
+    exit 1
+fi
+
+$MSP430_CC -I. -I../.. -S -o - "$2" | awk -v fname="$1" '
+function mode(op){
+    if (op ~ /^(r[0-9]+|sp|sr|pc)$/) return "reg"
+    if (op ~ /^#(0|1|2|4|8|-1|65535)$/) return "reg"       # Constant generator
+    if (op ~ /^#/) return "imm"
+    if (op ~ /^@.*\+$/) return "inc"
+    if (op ~ /^@/) return "ind"
+    return "idx"                                            # x(Rn), &abs, symbolic
+}
+function dmode(op){
+    if (op == "pc") return "pc"
+    if (mode(op) == "reg") return "reg"
+    return "mem"
+}
+function two(src, dst){
+    return cyc2[mode(src) "," dmode(dst)]
+}
+BEGIN {
+    split("reg,reg 1 reg,pc 2 reg,mem 4 ind,reg 2 ind,pc 2 ind,mem 5 inc,reg 2 inc,pc 3 inc,mem 5 " \
+          "imm,reg 2 imm,pc 3 imm,mem 5 idx,reg 3 idx,pc 3 idx,mem 6", t, " ")
+    for (i = 1; i < 30; i += 2) cyc2[t[i]] = t[i + 1]
+    split("reg 1 ind 3 inc 3 idx 4", t, " ");      for (i = 1; i < 8; i += 2) cyc1[t[i]] = t[i + 1]
+    split("reg 3 ind 4 inc 5 imm 4 idx 5", t, " "); for (i = 1; i < 10; i += 2) push[t[i]] = t[i + 1]
+    split("reg 4 ind 4 inc 5 imm 5 idx 5", t, " "); for (i = 1; i < 10; i += 2) call[t[i]] = t[i + 1]
+    total = 5                                       # CALL #func
+}
+$0 ~ "^" fname ":" { inside = 1; next }
+inside && /^\.Lfunc_end/ { inside = 0; done = 1 }
+!inside || /^[ \t]*[.;]/ || /^[^ \t]/ || NF == 0 { next }
+{
+    op = $1
+    sub(/\.[bw]$/, "", op)
+    rest = $0
+    sub(/^[ \t]*[^ \t]+[ \t]*/, "", rest)
+    n = split(rest, a, /,[ \t]*/)
+    if (op ~ /^j/) { print fname ": has jumps, cycles depend on the path" > "/dev/stderr"; bad = 1; exit 1 }
+    if (op ~ /^(mov|add|addc|sub|subc|cmp|dadd|bit|bic|bis|xor|and)$/) total += two(a[1], a[2])
+    else if (op ~ /^(rra|rrc|swpb|sxt)$/) total += cyc1[mode(a[1])]
+    else if (op == "push") total += push[mode(a[1])]
+    else if (op == "call") total += call[mode(a[1])]
+    else if (op ~ /^(clr|inc|incd|dec|decd|tst|inv|adc|sbc|dadc)$/) total += two("#0", a[1])
+    else if (op ~ /^(rla|rlc)$/) total += two(a[1], a[1])
+    else if (op ~ /^(clrc|setc|clrz|setz|clrn|setn|dint|eint|nop)$/) total += 1
+    else if (op == "pop") total += two("@sp+", a[1])
+    else if (op == "ret") total += 3
+    else if (op == "br") total += two(a[1], "pc")
+    else if (op == "reti") total += 5
+    else { print fname ": unknown instruction " op > "/dev/stderr"; bad = 1; exit 1 }
+}
+END {
+    if (bad) exit 1
+    if (!done) { print fname ": not found" > "/dev/stderr"; exit 1 }
+    print total
+}'
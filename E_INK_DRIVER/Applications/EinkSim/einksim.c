@@ -0,0 +1,399 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: einksim.c
+//                  Host simulator for the e-ink driver
+//                          Author: Sonikku
+//
+//              Runs the driver sources, unchanged, against a model of the panel controller (ssd16xx.c) through a
+//              host HAL (hal.c + msp430.h in this directory), then reports what every driver call cost on the
+//              wire: bytes, commands, RAM bytes, refreshes and modeled time. What the glass shows after each
+//              refresh can be written as PBM files. Last, the packed demo images (images.h) must unpack in the
+//              controller RAM to the raw ones in Source Images/, the bytes LoadText streams are checked against
+//              the original bit by bit loop, and WaitBusy is run against a panel that never drops BUSY
+//              (HalHoldBusy) and must time out cleanly; the exit status is 1 if any of these fails.
+//
+//              Build:  cc -m32 -fcommon -O2 -I. -I../.. -o einksim einksim.c ssd16xx.c hal.c
+//                          ../../display_driver.c ../../graphlib.c ../../displist.c ../../timer.c ../../clock.c
+//                      -m32 because the font tables in stdfonts.h keep glyph addresses in an int, as on the MSP430
+//                      -DHARDWARE_SCROLL adds a few ScrollDisplay steps
+//              optmatrix.sh builds and runs this at -O0/-O2/-O3/-Os and checks the output is identical
+//              Usage:  einksim [-b us_per_byte] [-d pbm_prefix]
+//                      -b  SPI byte time, default 4 (USCI_B0 at 2 MHz). The GPIO backend is nearer 12 at 16 MHz
+//                      -d  write <prefix>NNN.pbm after each refresh
+//
+//              Nothing here runs on the target and the model's refresh times are estimates (see ssd16xx.c) - use it
+//              to compare driver changes, not to predict the panel exactly.
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <msp430.h>
+#include "disp_driver.h"
+#include "graphlib.h"
+#include "displist.h"
+#include "timer.h"
+#include "clock.h"
+#include "stdfonts.h"
+#include "ssd16xx.h"
+#include "hal.h"
+#include "images.h"                             // The packed demo images, as main.c shows them
+
+// The same images as LCDImager wrote them, to check that the packed ones unpack to these
+#define Graphic1 doraemon_raw
+#include "../../Source Images/Doraemon/Doraemon.c"
+#undef Graphic1
+#define Graphic1 sonic_raw
+#include "../../Source Images/Sonic/Sonic.c"
+#undef Graphic1
+
+// Measure one driver call (or a few) and print a line for it
+#define MEASURE(name, call)     {Snapshot snap; TakeSnapshot(&snap); call; Report(name, &snap);}
+
+typedef struct {
+    CtrlStats ctrl;
+    HalStats hal;
+    unsigned long time_us;
+} Snapshot;
+
+static const DisplayCommand demo_list []={
+    {DL_TEXT,   0,   0,   0,  16, "  e-Ink DRIVER MSP430", Font2},
+    {DL_TEXT,   0,  16,   0,  16, "    Host simulator", Font2},
+    {DL_BAR,    8,  38, 184,   2, 0, 0},
+    {DL_BOX,    2,  48, 196, 100, 0, 0},
+    {DL_LINE,   2,  48, 197, 147, 0, 0},
+    {DL_LINE,   2, 147, 197,  48, 0, 0},
+    {DL_TEXT,   0, 160,   0,  16, "  Display list demo", Font2},
+    {DL_END,    0,   0,   0,   0, 0, 0}
+};
+
+static const unsigned char counter_window[16 * 8] = {0};       // 64 x 16 pixels, all white
+
+// Waveforms in display_driver.c, to check each refresh against GetRefreshMode()
+extern const unsigned char lut_full_update[];
+extern const unsigned char lut_partial_update[];
+#ifdef HARDWARE_SCROLL
+extern const unsigned char lut_scroll_update[];
+#endif
+
+static unsigned long lut_mismatches;
+
+static void TakeSnapshot(Snapshot *snap){
+    snap->ctrl = ctrl_stats;
+    snap->hal = hal_stats;
+    snap->time_us = CtrlNow();
+}
+
+//---------------------------------------------------------------
+// Name: CheckRefreshLUT
+// Function: The last refresh must have been driven with the waveform GetRefreshMode() reports
+//---------------------------------------------------------------
+static void CheckRefreshLUT(const char *name){
+    const unsigned char *expected;
+
+    expected = lut_full_update;
+    if (GetRefreshMode() == REFRESH_PARTIAL){
+        expected = lut_partial_update;
+    }
+#ifdef HARDWARE_SCROLL
+    if (GetRefreshMode() == REFRESH_SCROLL){
+        expected = lut_scroll_update;
+    }
+#endif
+    if (memcmp(CtrlRefreshLUT(), expected, 30) != 0){
+        printf("%s: refreshed with a LUT other than refresh mode %u\n", name, GetRefreshMode());
+        lut_mismatches++;
+    }
+}
+
+static void Report(const char *name, const Snapshot *snap){
+
+    if (ctrl_stats.refreshes != snap->ctrl.refreshes){
+        CheckRefreshLUT(name);                  // No step refreshes more than once
+    }
+    printf("%-34s %6lu %6lu %6lu %4lu %10.1f %10.1f\n", name,
+           ctrl_stats.bytes - snap->ctrl.bytes,
+           ctrl_stats.commands - snap->ctrl.commands,
+           ctrl_stats.ram_bytes - snap->ctrl.ram_bytes,
+           ctrl_stats.refreshes - snap->ctrl.refreshes,
+           (CtrlNow() - snap->time_us) / 1000.0,
+           (hal_stats.sleep_us - snap->hal.sleep_us) / 1000.0);
+}
+
+static void TextLine(const char *text, unsigned int y){
+
+    InitFrameBuffer();
+    DISPLAY_COLUMN = 4;
+    OutString(text, Font2);
+    LoadText(0, y, 1);
+}
+
+//---------------------------------------------------------------
+// Name: BusyTimeout
+// Function: WaitBusy with BUSY held HIGH: it must give up when the alarm fires, report the timeout, leave the alarm
+//           disarmed and put back the caller's clock (here the fast one)
+// Returns: 1 if all of that held, else 0
+//---------------------------------------------------------------
+static unsigned char BusyTimeout(void){
+    unsigned char clock;
+    unsigned char before;
+    unsigned char result;
+    unsigned char alarm_off;
+    unsigned char edge_off;
+    unsigned char restored;
+
+    clock = ClockFast();
+    before = BCSCTL2;
+    HalHoldBusy(1);
+    result = WaitBusy(50);
+    HalHoldBusy(0);
+    alarm_off = (TA0CCTL0 & CCIE) == 0;
+    edge_off = (P1IE & BIT1) == 0;
+    restored = BCSCTL2 == before;
+    ClockRestore(clock);
+
+    printf("busy timeout: WaitBusy returned %u, alarm %s, BUSY interrupt %s, clock %s\n", result,
+           alarm_off ? "disarmed" : "ARMED", edge_off ? "off" : "ON", restored ? "restored" : "NOT RESTORED");
+    return (result == 1) && alarm_off && edge_off && restored;
+}
+
+//---------------------------------------------------------------
+// Name: PackedImageMatches
+// Function: ShowPackedImage, then the RAM it was shown from against the raw image (inverted, as LoadBitmap sends
+//           it), line by line down the glass
+// Returns: Number of RAM bytes that differ
+//---------------------------------------------------------------
+static unsigned int PackedImageMatches(const unsigned char *packed, const char *raw){
+    const unsigned char *ram;
+    unsigned int x, y;
+    unsigned int bad = 0;
+
+    ShowPackedImage(packed);
+    for (y = 0; y < CTRL_Y_ROWS; y++){
+        ram = CtrlShownRow(y);
+        for (x = 0; x < CTRL_X_BYTES; x++){
+            if (ram[x] != (unsigned char)~raw[(y * CTRL_X_BYTES) + x]){
+                bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+//---------------------------------------------------------------
+// Name: ImageCheck
+// Function: The demo images of main.c shown packed (the start up BLANK_BITMAP too) must leave the controller RAM
+//           exactly as the raw images would
+// Returns: 1 if all three matched, else 0
+//---------------------------------------------------------------
+static unsigned char ImageCheck(void){
+    static const char blank_raw[CTRL_X_BYTES * CTRL_Y_ROWS] = {0};
+    unsigned int doraemon_bad;
+    unsigned int sonic_bad;
+    unsigned int blank_bad;
+
+    doraemon_bad = PackedImageMatches(Doraemon, doraemon_raw);
+    sonic_bad = PackedImageMatches(Sonic, sonic_raw);
+    blank_bad = PackedImageMatches(BLANK_BITMAP, blank_raw);
+
+    printf("packed images: Doraemon %u, Sonic %u, BLANK_BITMAP %u RAM bytes other than the raw image (%u and %u bytes packed)\n",
+           doraemon_bad, sonic_bad, blank_bad, (unsigned int)sizeof(Doraemon), (unsigned int)sizeof(Sonic));
+    return (doraemon_bad == 0) && (sonic_bad == 0) && (blank_bad == 0);
+}
+
+//---------------------------------------------------------------
+// Name: BaselineText
+// Function: The LoadText loop the driver shipped with, bit by bit, kept verbatim apart from WriteData(~temp)
+//           storing into out instead. Gives the 200 (height 0) or 400 bytes LoadText must stream for frame_buffer
+//---------------------------------------------------------------
+static unsigned int BaselineText(unsigned char height, unsigned char *out){
+    unsigned int sent = 0;
+
+    unsigned char linecnt;
+    unsigned int g = 0;
+    unsigned char h = 0;
+    unsigned char temp = 0;
+    unsigned char bitpos = 1;
+    unsigned char bpos = 0x80;
+    unsigned int target_addr = 0;
+    unsigned char frame_data;
+
+    // Need to write 8 horizontal lines
+    // Each horizontal line is 25 bytes of data
+    for (linecnt = 0; linecnt < 8; linecnt++){
+        for (g = 0; g < 25; g++){
+            for (h = 0; h < 8; h++){
+                frame_data = frame_buffer[target_addr];           // get frame buffer byte
+                if ((frame_data & bitpos) == bitpos){
+                    temp |= bpos;
+                } else {
+                    temp &= ~bpos;
+                }
+                target_addr++;
+                bpos >>= 1;
+            }
+            out[sent++] = ~temp;
+            bpos = 0x80;
+
+        }
+
+        target_addr = 0;
+        bitpos <<= 1;
+
+    }
+
+    target_addr = 200;
+    bitpos = 1;
+    bpos = 0x80;
+
+    if (height > 0){
+        for (linecnt = 0; linecnt < 8; linecnt++){
+            for (g = 0; g < 25; g++){
+                for (h = 0; h < 8; h++){
+                    frame_data = frame_buffer[target_addr];           // get frame buffer byte
+                    if ((frame_data & bitpos) == bitpos){
+                        temp |= bpos;
+                    } else {
+                        temp &= ~bpos;
+                    }
+                    target_addr++;
+                    bpos >>= 1;
+                }
+                out[sent++] = ~temp;
+                bpos = 0x80;
+            }
+
+            target_addr = 200;
+            bitpos <<= 1;
+        }
+    }
+
+    return sent;
+}
+
+//---------------------------------------------------------------
+// Name: TextCheck
+// Function: LoadText against BaselineText: the WRITE_RAM bytes streamed, in order, for both heights with every
+//           single pixel set, every byte value in each column position of a block, and pseudo random text rows.
+//           LoadText leaves frame_buffer transposed, so it is refilled from a copy for each run
+// Returns: 1 if every run matched, else 0
+//---------------------------------------------------------------
+static unsigned char TextCheck(void){
+    static unsigned char text[2 * DISPLAY_X_SIZE];
+    unsigned char expected[2 * DISPLAY_X_SIZE];
+    unsigned char streamed[2 * DISPLAY_X_SIZE];
+    unsigned long seed = 1;
+    unsigned long runs = 0;
+    unsigned long bad = 0;
+    unsigned int expected_count;
+    unsigned long streamed_count;
+    unsigned int n, k;
+    unsigned char height;
+
+    for (n = 0; n < (2 * DISPLAY_X_SIZE * 8) + (8 * 256) + 200; n++){
+        memset(text, 0, sizeof(text));
+        if (n < 2 * DISPLAY_X_SIZE * 8){
+            text[n / 8] = 0x01 << (n % 8);
+        } else if (n < (2 * DISPLAY_X_SIZE * 8) + (8 * 256)){
+            k = n - (2 * DISPLAY_X_SIZE * 8);
+            text[(k / 256) * 27] = k % 256;                     // Column j of block 3j in the top row
+            text[DISPLAY_X_SIZE + (k / 256) * 25] = ~(k % 256); // Inverted, 25 bytes apart in the bottom row
+        } else {
+            for (k = 0; k < sizeof(text); k++){
+                seed = (seed * 1103515245UL) + 12345;
+                text[k] = (unsigned char)(seed >> 16);
+            }
+        }
+        for (height = 0; height < 2; height++){
+            memcpy(frame_buffer, text, sizeof(text));
+            expected_count = BaselineText(height, expected);
+            CtrlCapture(streamed, sizeof(streamed));
+            LoadText(0, 96, height);
+            streamed_count = CtrlCapture(0, 0);
+            if ((streamed_count != expected_count) || (memcmp(streamed, expected, expected_count) != 0)){
+                bad++;
+            }
+            runs++;
+        }
+    }
+
+    printf("text rows: %lu LoadText runs, %lu streamed other bytes than the original bit by bit loop\n", runs, bad);
+    return bad == 0;
+}
+
+#ifdef HARDWARE_SCROLL
+static const char *const ticker_text[4] = {"Ticker one", "Ticker two", "Ticker three", "Ticker four"};
+
+static void TickerLine(const char *text){
+
+    SetBandOrigin(0);
+    SetBandClip(0, BAND_ROWS - 1);
+    ClearBand();
+    DISPLAY_ROW = 0;
+    DISPLAY_COLUMN = 4;
+    BlitString(text, Font2);
+    ScrollDisplay(16);
+}
+#endif
+
+int main(int argc, char **argv){
+    int n;
+    unsigned char timeout_ok;
+    unsigned char text_ok;
+    unsigned char image_ok;
+
+    for (n = 1; n < argc; n++){
+        if ((strcmp(argv[n], "-b") == 0) && (n + 1 < argc)){
+            HalSetByteTime(strtoul(argv[++n], 0, 0));
+        } else if ((strcmp(argv[n], "-d") == 0) && (n + 1 < argc)){
+            CtrlSetDumpPrefix(argv[++n]);
+        } else {
+            fprintf(stderr, "usage: einksim [-b us_per_byte] [-d pbm_prefix]\n");
+            return 1;
+        }
+    }
+
+    CtrlReset();
+    InitClock();
+    InitDriver();
+    InitTimerSystem();
+    __enable_interrupt();
+
+    printf("%-34s %6s %6s %6s %4s %10s %10s\n", "call", "bytes", "cmds", "ram", "refr", "time_ms", "busy_ms");
+
+    MEASURE("InitDisplay", InitDisplay());
+    MEASURE("ShowImage(BLANK_BITMAP)", ShowImage(BLANK_BITMAP));
+    MEASURE("ShowImage(BLANK_BITMAP) again", ShowImage(BLANK_BITMAP));
+    MEASURE("RenderDisplayList", RenderDisplayList(demo_list));
+    MEASURE("DisplayFrame", DisplayFrame());
+    MEASURE("LoadText x2 (OutString Font2)", {TextLine("Line one", 176); TextLine("Line two", 184);});
+    MEASURE("DisplayFrame", DisplayFrame());
+    MEASURE("SetRefreshMode(REFRESH_PARTIAL)", SetRefreshMode(REFRESH_PARTIAL));
+    MEASURE("LoadWindow 64x16", LoadWindow(counter_window, 64, 96, 127, 111));
+    MEASURE("DisplayFrame (partial)", DisplayFrame());
+    MEASURE("SetRefreshMode(REFRESH_FULL)", SetRefreshMode(REFRESH_FULL));
+    MEASURE("DoDisplayTest", DoDisplayTest());
+    MEASURE("DisplayFrame", DisplayFrame());
+    MEASURE("BlankScreen", BlankScreen());
+    MEASURE("DisplayFrame", DisplayFrame());
+#ifdef HARDWARE_SCROLL
+    MEASURE("ShowImage(BLANK_BITMAP)", ShowImage(BLANK_BITMAP));
+    for (n = 0; n < 4; n++){
+        MEASURE("ScrollDisplay(16)", TickerLine(ticker_text[n]));
+    }
+    MEASURE("LoadText after scrolling", TextLine("Line three", 96));
+    MEASURE("DisplayFrame (scroll)", DisplayFrame());
+    MEASURE("SetRefreshMode(REFRESH_FULL)", SetRefreshMode(REFRESH_FULL));
+    MEASURE("ShowImage(BLANK_BITMAP)", ShowImage(BLANK_BITMAP));
+#endif
+
+    printf("\ntotal: %lu bytes, %lu commands, %lu refreshes, %.1f ms modeled\n",
+           ctrl_stats.bytes, ctrl_stats.commands, ctrl_stats.refreshes, CtrlNow() / 1000.0);
+    printf("checks: %lu bytes while BUSY, %lu bytes without CS, %lu refreshes from a stale old image, %lu with the wrong LUT\n",
+           ctrl_stats.busy_violations, hal_stats.cs_errors, ctrl_stats.stale_refreshes, lut_mismatches);
+    image_ok = ImageCheck();
+    text_ok = TextCheck();
+    timeout_ok = BusyTimeout();
+
+    return ((ctrl_stats.busy_violations != 0) || (hal_stats.cs_errors != 0) || (lut_mismatches != 0) || !timeout_ok || !image_ok || !text_ok) ? 1 : 0;
+}
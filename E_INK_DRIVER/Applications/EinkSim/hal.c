@@ -0,0 +1,270 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: hal.c
+//                  Host side hardware layer for EinkSim
+//                          Author: Sonikku
+//
+//              Replaces the MSP430 registers, the intrinsics and spi_transport.c, so display_driver.c, graphlib.c,
+//              displist.c and timer.c build unchanged on a PC. Bytes from the transport go to the controller model
+//              with the D/C level (P1.4) they were sent with. BUSY (P1.1) follows the model, and the PORT1
+//              interrupt (CallInBusyISR) is run on its falling edge when the driver has armed it. The USCI_B0 ring
+//              in spi_transport.c is tested on its own by usciring.c.
+//
+//              Sleeping (LPM bits in __bis_SR_register) jumps modeled time to the end of the refresh, or when the panel
+//              is idle to the Delay() deadline on Timer0_A CCR1 (at the nominal VLO rate). HalHoldBusy() keeps BUSY
+//              HIGH, as a panel that never finishes, and sleeps then end at the WaitBusy alarm on CCR0.
+//
+//              Transport cost estimates (hand counted instruction cycles, not measured):
+//              GPIO  - 3 P2OUT writes and ~23 cycles per bit, ~190 cycles per byte with the call
+//              USCI  - 1 TXBUF write per byte, ~14 cycles per byte (the CPU loop is the limit, not SMCLK / 1)
+//              plus ~6 cycles per CS or D/C change and ~30 cycles of call overhead per WriteCommand / WriteData
+//              Cycles spent on the slow clock (MCLK divider in BCSCTL2, clock.c) are also counted on their own
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "disp_driver.h"
+#include "spi_transport.h"
+#include "timer.h"
+#include "ssd16xx.h"
+#include "hal.h"
+
+#define BUSY_PIN    BIT1                        // As display_driver.c
+#define DC_PIN      BIT4                        // As spi_transport.c
+
+volatile unsigned char P1IN, P1OUT, P1DIR, P1SEL, P1SEL2, P1IE, P1IES, P1IFG, P1REN;
+volatile unsigned char P2IN, P2OUT, P2DIR, P2SEL, P2SEL2, P2IE, P2IES, P2IFG, P2REN;
+volatile unsigned char DCOCTL, BCSCTL1, BCSCTL2, BCSCTL3;
+volatile unsigned char CALBC1_1MHZ, CALDCO_1MHZ, CALBC1_16MHZ, CALDCO_16MHZ;
+volatile unsigned char IE1, IFG1, IE2, IFG2;
+volatile unsigned int WDTCTL;
+volatile unsigned int TA0CTL, TA0R, TA0CCTL0, TA0CCR0, TA0CCTL1, TA0CCR1, TA0CCTL2, TA0CCR2, TA0IV;
+volatile unsigned int TA1CTL, TA1R, TA1CCTL0, TA1CCR0, TA1CCTL1, TA1CCR1, TA1CCTL2, TA1CCR2, TA1IV;
+volatile unsigned char UCA0CTL0, UCA0CTL1, UCA0BR0, UCA0BR1, UCA0MCTL, UCA0STAT, UCA0TXBUF, UCA0RXBUF;
+volatile unsigned char UCB0CTL0, UCB0CTL1, UCB0BR0, UCB0BR1, UCB0STAT, UCB0TXBUF, UCB0RXBUF;
+
+HalStats hal_stats;
+
+#define GPIO_BYTE_CYCLES    190
+#define USCI_BYTE_CYCLES    14
+#define PIN_CHANGE_CYCLES   6
+#define QUEUE_CALL_CYCLES   30
+#define TIMER_TICK_US       ((64000UL + (TIMER_RATE_NOMINAL / 2)) / TIMER_RATE_NOMINAL)
+
+static unsigned long byte_us = 4;               // USCI_B0 at SMCLK = 2 MHz
+static unsigned char backend = HAL_GPIO;
+static unsigned char interrupts_on;
+static unsigned char cs_low;
+static unsigned char busy_held;
+
+
+//---------------------------------------------------------------
+// Name: HalSetByteTime
+// Function: Modeled time per SPI byte (us)
+//---------------------------------------------------------------
+void HalSetByteTime(unsigned long us){
+    byte_us = us;
+}
+
+//---------------------------------------------------------------
+// Name: HalSetBackend
+// Function: Transport the cost estimates are for (HAL_GPIO / HAL_USCI)
+//---------------------------------------------------------------
+void HalSetBackend(unsigned char which){
+    backend = which;
+}
+
+static void AddCycles(unsigned long cycles){
+    hal_stats.cycles += cycles;
+    if ((BCSCTL2 & DIVM_3) != 0){
+        hal_stats.slow_cycles += cycles;
+    }
+}
+
+static void PinChange(void){
+    hal_stats.pin_writes++;
+    AddCycles(PIN_CHANGE_CYCLES);
+}
+
+//---------------------------------------------------------------
+// Name: UpdatePins
+// Function: Bring P1IN.BUSY up to date with the model, raise the PORT1 interrupt on a falling edge
+//---------------------------------------------------------------
+static void UpdatePins(void){
+    unsigned char was_busy;
+
+    was_busy = P1IN & BUSY_PIN;
+    if (CtrlBusy() || busy_held){
+        P1IN |= BUSY_PIN;
+    } else {
+        P1IN &= ~BUSY_PIN;
+    }
+
+    if ((was_busy != 0) && ((P1IN & BUSY_PIN) == 0) && ((P1IES & BUSY_PIN) != 0)){
+        P1IFG |= BUSY_PIN;
+    }
+    if (interrupts_on && ((P1IFG & P1IE & BUSY_PIN) != 0)){
+        CallInBusyISR();
+    }
+}
+
+//---------------------------------------------------------------
+// Name: HalHoldBusy
+// Function: 1 = hold BUSY HIGH whatever the model does (stuck panel), 0 = follow the model again
+//---------------------------------------------------------------
+void HalHoldBusy(unsigned char hold){
+    busy_held = hold;
+    UpdatePins();
+}
+
+static void SendByte(unsigned char data){
+
+    if (!cs_low){
+        hal_stats.cs_errors++;                  // Byte clocked with CS HIGH - the controller would ignore it
+    }
+    CtrlByte(data, (P1OUT & DC_PIN) != 0);
+    CtrlAdvance(byte_us);
+    if (backend == HAL_GPIO){
+        hal_stats.pin_writes += 24;
+        AddCycles(GPIO_BYTE_CYCLES);
+    } else {
+        hal_stats.pin_writes += 1;
+        AddCycles(USCI_BYTE_CYCLES);
+    }
+    UpdatePins();
+}
+
+
+// Intrinsics
+//------------
+void __delay_cycles(unsigned long cycles){
+    (void)cycles;
+}
+
+void __enable_interrupt(void){
+    interrupts_on = 1;
+    UpdatePins();
+}
+
+void __disable_interrupt(void){
+    interrupts_on = 0;
+}
+
+void __no_operation(void){
+}
+
+unsigned short __get_SR_register(void){
+    return interrupts_on ? GIE : 0;
+}
+
+unsigned short __get_interrupt_state(void){
+    return interrupts_on ? GIE : 0;
+}
+
+void __set_interrupt_state(unsigned short state){
+    interrupts_on = (state & GIE) != 0;
+}
+
+void __bis_SR_register(unsigned short bits){
+
+    unsigned long us;
+
+    if (bits & GIE){
+        interrupts_on = 1;
+    }
+    if (bits & CPUOFF){
+        hal_stats.sleeps++;
+        if (busy_held && ((TA0CCTL0 & CCIE) != 0)){
+            us = (unsigned long)(unsigned short)(TA0CCR0 - TA0R) * TIMER_TICK_US;
+            hal_stats.sleep_us += us;
+            CtrlAdvance(us);
+            TA0R = TA0CCR0;
+            CallInAlarmISR();                   // WaitBusy timeout
+        } else if (CtrlBusy() || ((TA0CCTL1 & CCIE) == 0)){
+            us = CtrlBusyLeft();                // Nothing else can wake the CPU in the model
+            hal_stats.sleep_us += us;
+            CtrlAdvance(us);
+        } else {
+            us = (unsigned long)(unsigned short)(TA0CCR1 - TA0R) * TIMER_TICK_US;
+            hal_stats.sleep_us += us;
+            CtrlAdvance(us);
+            TA0R = TA0CCR1;
+            CallInDelayISR();                   // Delay() deadline
+        }
+    }
+    UpdatePins();
+}
+
+void __bic_SR_register(unsigned short bits){
+    if (bits & GIE){
+        interrupts_on = 0;
+    }
+}
+
+void __bis_SR_register_on_exit(unsigned short bits){
+    (void)bits;
+}
+
+void __bic_SR_register_on_exit(unsigned short bits){
+    (void)bits;
+}
+
+
+// Transport (spi_transport.h), synchronous like the GPIO backend
+//-----------------------------------------------------------------
+void InitTransport(void){
+    cs_low = 0;
+    P1OUT &= ~DC_PIN;
+}
+
+void TransportSelect(void){
+    cs_low = 1;
+    PinChange();
+}
+
+void TransportDeselect(void){
+    cs_low = 0;
+    PinChange();
+}
+
+void TransportFlush(void){
+}
+
+void TransportWrite(unsigned char data){
+    SendByte(data);
+}
+
+void TransportQueue(unsigned char data, unsigned char tag){
+
+    AddCycles(QUEUE_CALL_CYCLES);
+    TransportSetDC(tag);
+    TransportSelect();
+    SendByte(data);
+    TransportDeselect();
+}
+
+void TransportSetDC(unsigned char tag){
+
+    if (tag == TX_DATA){
+        P1OUT |= DC_PIN;
+    } else {
+        P1OUT &= ~DC_PIN;
+    }
+    PinChange();
+}
+
+void TransportWriteBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask){
+
+    while (len != 0){
+        SendByte(*src ^ xor_mask);
+        src++;
+        len--;
+    }
+}
+
+unsigned char TransportBusy(void){
+    return 0;
+}
+
+unsigned char CallInTransportISR(void){
+    return 0;
+}
@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for hal.c (EinkSim)
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef HAL_H_
+#define HAL_H_
+
+// Transport being modeled, for the cost estimates
+#define HAL_GPIO    0                           // Bit-banged (SPI_TRANSPORT_GPIO)
+#define HAL_USCI    1                           // USCI_B0 (SPI_TRANSPORT_USCI_B0)
+
+typedef struct {
+    unsigned long sleeps;                       // LPM entries (BUSY waits that slept)
+    unsigned long sleep_us;                     // Modeled time spent asleep
+    unsigned long cs_errors;                    // Bytes sent without CS
+    unsigned long pin_writes;                   // Port / USCI register writes done by the transport
+    unsigned long cycles;                       // Estimated MSP430 cycles spent in the transport
+    unsigned long slow_cycles;                  // Of which with MCLK divided down (ClockSlow, see clock.h)
+} HalStats;
+
+extern HalStats hal_stats;
+
+void HalSetByteTime(unsigned long us);
+void HalSetBackend(unsigned char backend);
+void HalHoldBusy(unsigned char hold);
+
+#endif /* HAL_H_ */
@@ -0,0 +1,114 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Host stand-in for <msp430.h> (EinkSim)
+//
+//              Just enough of the MSP430G2553 header for the driver sources to build on a PC: the peripheral
+//              registers they touch are plain variables (see hal.c) and the intrinsics are functions.
+//              Put this directory first on the include path.
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef EINKSIM_MSP430_H_
+#define EINKSIM_MSP430_H_
+
+// Port 1 / Port 2
+extern volatile unsigned char P1IN, P1OUT, P1DIR, P1SEL, P1SEL2, P1IE, P1IES, P1IFG, P1REN;
+extern volatile unsigned char P2IN, P2OUT, P2DIR, P2SEL, P2SEL2, P2IE, P2IES, P2IFG, P2REN;
+
+// Clocks, watchdog, interrupt enables
+extern volatile unsigned char DCOCTL, BCSCTL1, BCSCTL2, BCSCTL3;
+extern volatile unsigned char CALBC1_1MHZ, CALDCO_1MHZ, CALBC1_16MHZ, CALDCO_16MHZ;
+extern volatile unsigned char IE1, IFG1, IE2, IFG2;
+extern volatile unsigned int WDTCTL;
+
+// Timer0_A / Timer1_A
+extern volatile unsigned int TA0CTL, TA0R, TA0CCTL0, TA0CCR0, TA0CCTL1, TA0CCR1, TA0CCTL2, TA0CCR2, TA0IV;
+extern volatile unsigned int TA1CTL, TA1R, TA1CCTL0, TA1CCR0, TA1CCTL1, TA1CCR1, TA1CCTL2, TA1CCR2, TA1IV;
+
+// USCI
+extern volatile unsigned char UCA0CTL0, UCA0CTL1, UCA0BR0, UCA0BR1, UCA0MCTL, UCA0STAT, UCA0TXBUF, UCA0RXBUF;
+extern volatile unsigned char UCB0CTL0, UCB0CTL1, UCB0BR0, UCB0BR1, UCB0STAT, UCB0TXBUF, UCB0RXBUF;
+
+#define BIT0                (0x0001)
+#define BIT1                (0x0002)
+#define BIT2                (0x0004)
+#define BIT3                (0x0008)
+#define BIT4                (0x0010)
+#define BIT5                (0x0020)
+#define BIT6                (0x0040)
+#define BIT7                (0x0080)
+
+#define GIE                 (0x0008)
+#define CPUOFF              (0x0010)
+#define OSCOFF              (0x0020)
+#define SCG0                (0x0040)
+#define SCG1                (0x0080)
+#define LPM0_bits           (CPUOFF)
+#define LPM3_bits           (SCG1 + SCG0 + CPUOFF)
+#define LPM4_bits           (SCG1 + SCG0 + OSCOFF + CPUOFF)
+
+#define WDTPW               (0x5A00)
+#define WDTHOLD             (0x0080)
+#define WDTTMSEL            (0x0010)
+#define WDTCNTCL            (0x0008)
+#define WDTSSEL             (0x0004)
+#define WDTIS0              (0x0001)
+#define WDTIS1              (0x0002)
+#define WDT_MDLY_0_5        (WDTPW + WDTTMSEL + WDTCNTCL + WDTIS1 + WDTIS0)
+#define WDTIE               (0x01)
+#define WDTIFG              (0x01)
+
+#define LFXT1S_2            (0x20)
+#define DIVA_0              (0x00)
+#define DIVA_3              (0x30)
+#define DIVM_0              (0x00)
+#define DIVM_3              (0x30)
+#define DIVS_0              (0x00)
+#define DIVS_3              (0x06)
+
+#define TASSEL_1            (0x0100)
+#define TASSEL_2            (0x0200)
+#define ID_0                (0x0000)
+#define ID_3                (0x00C0)
+#define MC_0                (0x0000)
+#define MC_1                (0x0010)
+#define MC_2                (0x0020)
+#define TACLR               (0x0004)
+#define TAIE                (0x0002)
+#define TAIFG               (0x0001)
+#define CM_1                (0x4000)
+#define CM_3                (0xC000)
+#define CCIS_1              (0x1000)
+#define SCS                 (0x0800)
+#define CAP                 (0x0100)
+#define CCIE                (0x0010)
+#define COV                 (0x0002)
+#define CCIFG               (0x0001)
+
+#define UCSWRST             (0x01)
+#define UCSSEL_2            (0x80)
+#define UCCKPH              (0x80)
+#define UCCKPL              (0x40)
+#define UCMSB               (0x20)
+#define UCMST               (0x08)
+#define UCSYNC              (0x01)
+#define UCBUSY              (0x01)
+#define UCBRS_1             (0x02)
+#define UCA0TXIFG           (0x02)
+#define UCB0TXIFG           (0x08)
+#define UCA0TXIE            (0x02)
+#define UCB0TXIE            (0x08)
+
+#define __interrupt
+
+void __delay_cycles(unsigned long cycles);
+void __enable_interrupt(void);
+void __disable_interrupt(void);
+void __no_operation(void);
+unsigned short __get_SR_register(void);
+void __bis_SR_register(unsigned short bits);
+void __bic_SR_register(unsigned short bits);
+void __bis_SR_register_on_exit(unsigned short bits);
+void __bic_SR_register_on_exit(unsigned short bits);
+unsigned short __get_interrupt_state(void);
+void __set_interrupt_state(unsigned short state);
+
+#endif /* EINKSIM_MSP430_H_ */
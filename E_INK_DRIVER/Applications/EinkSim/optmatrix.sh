@@ -0,0 +1,58 @@
+#!/bin/sh
+#---------------------------------------------------------------------------------------------------------------------------
+#
+#                      Name: optmatrix.sh
+#                  Optimisation level check for the driver sources (EinkSim)
+#                          Author: Sonikku
+#
+#              Builds einksim at -O0, -O2, -O3 and -Os, runs each with the frames written as PBM files, and checks
+#              that the report and every frame are byte for byte the same at all levels. A difference means code
+#              whose result depends on the optimiser (a missing volatile, undefined behaviour ...), so fix that
+#              before raising the optimisation level of the target build.
+#
+#              Usage:  sh optmatrix.sh             (from this directory)
+#                      CC and CFLAGS may be set, default cc and -m32 (see einksim.c). The builds are kept in
+#                      $TMPDIR/optmatrix.<pid> for a closer look when something differs
+#---------------------------------------------------------------------------------------------------------------------------
+
+CC=${CC:-cc}
+CFLAGS=${CFLAGS--m32}
+SRC=../..
+OUT=${TMPDIR:-/tmp}/optmatrix.$$
+LEVELS="O0 O2 O3 Os"
+
+SOURCES="einksim.c ssd16xx.c hal.c $SRC/display_driver.c $SRC/graphlib.c $SRC/displist.c $SRC/timer.c $SRC/clock.c"
+
+for level in $LEVELS; do
+    mkdir -p "$OUT/$level"
+    if ! $CC $CFLAGS -$level -fcommon -I. -I$SRC -o "$OUT/$level/einksim" $SOURCES; then
+        echo "$level: build failed"
+        exit 1
+    fi
+    if ! (cd "$OUT/$level" && ./einksim -d frame > report.txt); then
+        echo "$level: einksim failed"
+        exit 1
+    fi
+done
+
+status=0
+for level in $LEVELS; do
+    if [ "$level" = "O0" ]; then
+        continue
+    fi
+    for file in $(cd "$OUT/O0" && ls report.txt frame*.pbm); do
+        if ! cmp -s "$OUT/O0/$file" "$OUT/$level/$file"; then
+            echo "$level: $file differs from -O0"
+            status=1
+        fi
+    done
+    if [ "$(ls "$OUT/O0" | wc -l)" != "$(ls "$OUT/$level" | wc -l)" ]; then
+        echo "$level: number of frames differs from -O0"
+        status=1
+    fi
+done
+
+if [ $status -eq 0 ]; then
+    echo "$(ls "$OUT/O0"/frame*.pbm | wc -l) frames and the report identical at $LEVELS"
+fi
+exit $status
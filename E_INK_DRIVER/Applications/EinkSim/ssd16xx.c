@@ -0,0 +1,327 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: ssd16xx.c
+//                  Model of the SSD1608 / IL3829 class controller on the 1.54" panel (EinkSim)
+//                          Author: Sonikku
+//
+//              Decodes the command set in disp_driver.h byte by byte: RAM window and address counters, data entry
+//              modes, WRITE_RAM, the LUT, gate scan start and MASTER_ACTIVATION. Two RAM banks are kept; each refresh
+//              shows the bank being written and swaps, as the real controller does.
+//
+//              Time is modeled, not measured: every byte costs the SPI byte time given to the simulator and a
+//              refresh keeps BUSY HIGH for the frames listed in the LUT timing bytes (20 - 29, two 4 bit phase
+//              lengths per byte) at SIM_FRAME_US per frame. The full update LUT comes out at about 1.6 s and the
+//              partial one at 0.4 s, near enough to the panel to compare driver changes.
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd16xx.h"
+#include "disp_driver.h"
+
+#define SIM_FRAME_US    20000UL                 // ~50 Hz frame rate with the dummy line / gate time settings used
+
+CtrlStats ctrl_stats;
+
+static unsigned char bank[2][CTRL_Y_ROWS][CTRL_X_BYTES];
+static unsigned char glass[CTRL_Y_ROWS][CTRL_X_BYTES];
+static unsigned char write_bank;
+static unsigned char lut[30];
+static unsigned char refresh_lut[30];           // LUT of the last MASTER_ACTIVATION
+static unsigned char entry_mode;
+static unsigned int gate_start;
+static unsigned char x_start, x_end, x_count;
+static unsigned int y_start, y_end, y_count;
+
+static unsigned char command;
+static unsigned char args[32];
+static unsigned int arg_count;
+
+static unsigned long now_us;
+static unsigned long busy_until_us;
+static const char *dump_prefix;
+static unsigned char *capture;                  // WRITE_RAM data is also copied here in order (CtrlCapture)
+static unsigned long capture_size, capture_count;
+
+//---------------------------------------------------------------
+// Name: CtrlReset
+// Function: Power on / hardware reset state. RAM is random on the real thing, filled with a pattern here
+//---------------------------------------------------------------
+void CtrlReset(void){
+    unsigned int y;
+
+    for (y = 0; y < CTRL_Y_ROWS; y++){
+        memset(bank[0][y], (y & 1) ? 0x55 : 0xAA, CTRL_X_BYTES);
+        memset(bank[1][y], (y & 1) ? 0xAA : 0x55, CTRL_X_BYTES);
+    }
+    memset(glass, 0xFF, sizeof(glass));
+    memset(lut, 0, sizeof(lut));
+    write_bank = 0;
+    entry_mode = 0x03;
+    gate_start = 0;
+    x_start = 0;
+    x_end = CTRL_X_BYTES - 1;
+    y_start = 0;
+    y_end = CTRL_Y_ROWS - 1;
+    x_count = 0;
+    y_count = 0;
+    command = 0;
+    arg_count = 0;
+    busy_until_us = now_us;
+}
+
+//---------------------------------------------------------------
+// Name: RamWrite
+// Function: Store one byte at the address counter and move the counter as set by the data entry mode
+//           (bit 0 = X increment, bit 1 = Y increment, bit 2 = Y direction first), wrapping inside the window
+//---------------------------------------------------------------
+static void RamWrite(unsigned char data){
+    unsigned char x_wrapped = 0;
+    unsigned char y_wrapped = 0;
+
+    if ((x_count < CTRL_X_BYTES) && (y_count < CTRL_Y_ROWS)){
+        bank[write_bank][y_count][x_count] = data;
+    }
+    ctrl_stats.ram_bytes++;
+    if (capture_count < capture_size){
+        capture[capture_count] = data;
+    }
+    capture_count++;
+
+    if ((entry_mode & 0x04) == 0){
+        // X first
+        if (entry_mode & 0x01){
+            if (x_count == x_end){ x_count = x_start; x_wrapped = 1; } else { x_count++; }
+        } else {
+            if (x_count == x_start){ x_count = x_end; x_wrapped = 1; } else { x_count--; }
+        }
+        if (!x_wrapped){
+            return;
+        }
+        if (entry_mode & 0x02){
+            y_count = (y_count == y_end) ? y_start : y_count + 1;
+        } else {
+            y_count = (y_count == y_start) ? y_end : y_count - 1;
+        }
+    } else {
+        // Y first
+        if (entry_mode & 0x02){
+            if (y_count == y_end){ y_count = y_start; y_wrapped = 1; } else { y_count++; }
+        } else {
+            if (y_count == y_start){ y_count = y_end; y_wrapped = 1; } else { y_count--; }
+        }
+        if (!y_wrapped){
+            return;
+        }
+        if (entry_mode & 0x01){
+            x_count = (x_count == x_end) ? x_start : x_count + 1;
+        } else {
+            x_count = (x_count == x_start) ? x_end : x_count - 1;
+        }
+    }
+}
+
+//---------------------------------------------------------------
+// Name: RefreshTime
+// Function: BUSY time of a refresh with the loaded LUT
+//---------------------------------------------------------------
+static unsigned long RefreshTime(void){
+    unsigned long frames = 0;
+    unsigned int n;
+
+    for (n = 20; n < 30; n++){
+        frames += (lut[n] >> 4) + (lut[n] & 0x0F);
+    }
+    return frames * SIM_FRAME_US;
+}
+
+//---------------------------------------------------------------
+// Name: LutUsesOldImage
+// Function: 0 if every phase of the loaded LUT drives 0->0 as 1->0 and 1->1 as 0->1 (two bits per transition, in
+//           that order from the top), so the result doesn't depend on the old bank
+//---------------------------------------------------------------
+static int LutUsesOldImage(void){
+    unsigned int n;
+
+    for (n = 0; n < 20; n++){
+        if ((((lut[n] >> 6) & 3) != ((lut[n] >> 2) & 3)) || (((lut[n] >> 4) & 3) != (lut[n] & 3))){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------
+// Name: Activate
+// Function: MASTER_ACTIVATION - the written bank goes to the glass, the banks swap
+//---------------------------------------------------------------
+static void Activate(void){
+    unsigned int y;
+    char path[256];
+
+    if (LutUsesOldImage()){
+        for (y = 0; y < CTRL_Y_ROWS; y++){
+            if (memcmp(bank[write_bank ^ 1][(y + gate_start) % CTRL_Y_ROWS], glass[y], CTRL_X_BYTES) != 0){
+                ctrl_stats.stale_refreshes++;   // Waveform is driven from a wrong "old" image - ghosting
+                break;
+            }
+        }
+    }
+
+    for (y = 0; y < CTRL_Y_ROWS; y++){
+        memcpy(glass[y], bank[write_bank][(y + gate_start) % CTRL_Y_ROWS], CTRL_X_BYTES);
+    }
+    write_bank ^= 1;
+
+    memcpy(refresh_lut, lut, sizeof(lut));
+    ctrl_stats.refreshes++;
+    ctrl_stats.refresh_us += RefreshTime();
+    busy_until_us = now_us + RefreshTime();
+
+    if (dump_prefix != 0){
+        snprintf(path, sizeof(path), "%s%03lu.pbm", dump_prefix, ctrl_stats.refreshes);
+        CtrlWritePBM(path);
+    }
+}
+
+//---------------------------------------------------------------
+// Name: Parameter
+// Function: Act on a parameter byte of the current command
+//---------------------------------------------------------------
+static void Parameter(unsigned char data){
+
+    if (arg_count < sizeof(args)){
+        args[arg_count] = data;
+    }
+    arg_count++;
+
+    switch (command){
+    case DATA_ENTRY_MODE_SETTING:
+        entry_mode = data & 0x07;
+        break;
+    case SET_RAM_X_ADDRESS_START_END_POSITION:
+        if (arg_count == 1) x_start = data;
+        if (arg_count == 2) x_end = data;
+        break;
+    case SET_RAM_Y_ADDRESS_START_END_POSITION:
+        if (arg_count == 2) y_start = args[0] | (data << 8);
+        if (arg_count == 4) y_end = args[2] | (data << 8);
+        break;
+    case SET_RAM_X_ADDRESS_COUNTER:
+        if (arg_count == 1) x_count = data;
+        break;
+    case SET_RAM_Y_ADDRESS_COUNTER:
+        if (arg_count == 2) y_count = args[0] | (data << 8);
+        break;
+    case GATE_SCAN_START_POSITION:
+        if (arg_count == 2) gate_start = (args[0] | (data << 8)) % CTRL_Y_ROWS;
+        break;
+    case WRITE_LUT_REGISTER:
+        if (arg_count <= sizeof(lut)) lut[arg_count - 1] = data;
+        break;
+    case WRITE_RAM:
+        RamWrite(data);
+        break;
+    default:
+        break;                                  // Analogue settings etc. - accepted, no effect on the model
+    }
+}
+
+//---------------------------------------------------------------
+// Name: CtrlByte
+// Function: One byte off the SPI bus, D/C as sampled with its last bit
+//---------------------------------------------------------------
+void CtrlByte(unsigned char byte, unsigned char is_data){
+
+    ctrl_stats.bytes++;
+    if (CtrlBusy() && (is_data || (byte != TERMINATE_FRAME_READ_WRITE))){
+        ctrl_stats.busy_violations++;           // 0xFF is a NOP, sent straight after MASTER_ACTIVATION
+    }
+
+    if (!is_data){
+        ctrl_stats.commands++;
+        command = byte;
+        arg_count = 0;
+        if (byte == MASTER_ACTIVATION){
+            Activate();
+        } else if (byte == SW_RESET){
+            CtrlReset();
+        }
+        return;
+    }
+    Parameter(byte);
+}
+
+void CtrlAdvance(unsigned long us){
+    now_us += us;
+}
+
+unsigned long CtrlNow(void){
+    return now_us;
+}
+
+unsigned char CtrlBusy(void){
+    return now_us < busy_until_us;
+}
+
+//---------------------------------------------------------------
+// Name: CtrlRefreshLUT
+// Function: The 30 LUT bytes the last refresh was driven with
+//---------------------------------------------------------------
+const unsigned char *CtrlRefreshLUT(void){
+    return refresh_lut;
+}
+
+//---------------------------------------------------------------
+// Name: CtrlShownRow
+// Function: The RAM row (CTRL_X_BYTES) the last refresh drove glass line y from, in the bank it showed. Not the
+//           same row number as y once the gate scan start has moved (ScrollDisplay)
+//---------------------------------------------------------------
+const unsigned char *CtrlShownRow(unsigned int y){
+    return bank[write_bank ^ 1][(y + gate_start) % CTRL_Y_ROWS];
+}
+
+unsigned long CtrlBusyLeft(void){
+    return CtrlBusy() ? (busy_until_us - now_us) : 0;
+}
+
+//---------------------------------------------------------------
+// Name: CtrlCapture
+// Function: Copy the WRITE_RAM data bytes that follow into buffer, in the order sent, up to size bytes
+//           (buffer = 0 stops). Returns how many were sent since the last call, captured or not
+//---------------------------------------------------------------
+unsigned long CtrlCapture(unsigned char *buffer, unsigned long size){
+    unsigned long count = capture_count;
+
+    capture = buffer;
+    capture_size = (buffer != 0) ? size : 0;
+    capture_count = 0;
+    return count;
+}
+
+void CtrlSetDumpPrefix(const char *prefix){
+    dump_prefix = prefix;
+}
+
+//---------------------------------------------------------------
+// Name: CtrlWritePBM
+// Function: Write what the glass shows as a PBM (P4). Panel 0 = black, PBM 1 = black
+//---------------------------------------------------------------
+int CtrlWritePBM(const char *path){
+    FILE *f;
+    unsigned int y;
+    unsigned int x;
+
+    f = fopen(path, "wb");
+    if (f == 0){
+        return -1;
+    }
+    fprintf(f, "P4\n%d %d\n", CTRL_X_BYTES * 8, CTRL_Y_ROWS);
+    for (y = 0; y < CTRL_Y_ROWS; y++){
+        for (x = 0; x < CTRL_X_BYTES; x++){
+            fputc(glass[y][x] ^ 0xFF, f);
+        }
+    }
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for ssd16xx.c (EinkSim)
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef SSD16XX_H_
+#define SSD16XX_H_
+
+#define CTRL_X_BYTES    25                      // RAM size of the 200 x 200 panel
+#define CTRL_Y_ROWS     200
+
+// Running totals, never cleared - take differences around the code being measured
+typedef struct {
+    unsigned long bytes;                        // Everything clocked in
+    unsigned long commands;
+    unsigned long ram_bytes;                    // WRITE_RAM data
+    unsigned long refreshes;
+    unsigned long refresh_us;                   // Modeled BUSY time of all refreshes
+    unsigned long busy_violations;              // Bytes received while BUSY was HIGH
+    unsigned long stale_refreshes;              // Refreshes where the "old" bank didn't match the glass
+} CtrlStats;
+
+extern CtrlStats ctrl_stats;
+
+void CtrlReset(void);
+void CtrlByte(unsigned char byte, unsigned char is_data);
+void CtrlAdvance(unsigned long us);
+unsigned long CtrlNow(void);
+unsigned char CtrlBusy(void);
+unsigned long CtrlBusyLeft(void);
+const unsigned char *CtrlRefreshLUT(void);
+const unsigned char *CtrlShownRow(unsigned int y);
+unsigned long CtrlCapture(unsigned char *buffer, unsigned long size);
+void CtrlSetDumpPrefix(const char *prefix);
+int CtrlWritePBM(const char *path);
+
+#endif /* SSD16XX_H_ */
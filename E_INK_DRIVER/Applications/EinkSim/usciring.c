@@ -0,0 +1,298 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: usciring.c
+//                  Replay of the USCI_B0 transport into the controller model (EinkSim)
+//                          Author: Sonikku
+//
+//              einksim and einkbench send bytes through the synchronous transport in hal.c, so the TX ring, the
+//              block sender and CallInTransportISR() in spi_transport.c never run there. This builds spi_transport.c
+//              itself with the USCI_B0 backend (whatever spi_transport.h selects) against a model of the USCI:
+//              TXBUF, the shifter, TXIFG and UCBUSY. The TX interrupt is a timer signal, so it lands anywhere in the
+//              foreground code as it would on the part; IE2.UCB0TXIE masks it as there.
+//
+//              A script of TransportQueue / TransportWriteBlock / TransportWrite calls (ring full, blocks split in
+//              pieces, XOR masks, bytes queued behind a running block) is run several times with different interrupt
+//              rates. Every byte leaving the shifter is checked against the script in order, with the D/C level it
+//              was sampled with and CS, and is fed to the controller model (ssd16xx.c), which must decode the same
+//              number of commands and RAM bytes.
+//
+//              Build:  cc -O2 -I. -I../.. -o usciring usciring.c ssd16xx.c
+//              Usage:  usciring            (exit status 0 when every byte arrived as sent)
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <msp430.h>
+#include "disp_driver.h"
+#include "ssd16xx.h"
+
+#include "spi_transport.h"
+#undef SPI_TRANSPORT_GPIO
+#define SPI_TRANSPORT_USCI_B0
+
+// USCI model: TXBUF holds 0x100 when empty, which a byte store can't produce, so loading it is a single store that
+// the interrupt can't split. TXIFG follows from it, UCBUSY reads let the shifter run (the ISR spins on it)
+static volatile unsigned int usci_txbuf = 0x100;
+static unsigned char UsciStat(void);
+#define UCB0TXBUF   usci_txbuf
+#define IFG2        ((usci_txbuf > 0xFF) ? UCB0TXIFG : 0)
+#define UCB0STAT    UsciStat()
+
+#include "spi_transport.c"
+
+#define DC_PIN      BIT4                        // As spi_transport.c
+#define CS_PIN      BIT0                        // P2.0 with the USCI_B0 backend
+#define ROUNDS      8
+#define MAX_BYTES   4096
+
+volatile unsigned char P1IN, P1OUT, P1DIR, P1SEL, P1SEL2, P1IE, P1IES, P1IFG, P1REN;
+volatile unsigned char P2IN, P2OUT, P2DIR, P2SEL, P2SEL2, P2IE, P2IES, P2IFG, P2REN;
+volatile unsigned char IE1, IFG1, IE2;
+volatile unsigned char UCB0CTL0, UCB0CTL1, UCB0BR0, UCB0BR1, UCB0RXBUF;
+
+static unsigned int shifter = 0x100;            // Byte being clocked out, 0x100 = idle
+
+// What the script sent, what came out of the shifter
+static unsigned int expected[MAX_BYTES];        // Byte | 0x100 for data
+static unsigned int expected_count;
+static unsigned long expected_commands;
+static unsigned long expected_ram;
+static unsigned char expected_last_command;
+static volatile unsigned int received[MAX_BYTES];
+static volatile unsigned int received_count;
+static volatile unsigned long cs_errors;
+
+static unsigned char pattern[600];              // No two neighbours alike, so a lost or repeated byte shows
+
+//---------------------------------------------------------------
+// Name: ShiftOut
+// Function: The byte in the shifter has been clocked out: D/C is sampled with the last bit
+//---------------------------------------------------------------
+static void ShiftOut(void){
+
+    unsigned int tagged;
+
+    tagged = shifter | (((P1OUT & DC_PIN) != 0) ? 0x100 : 0);
+    if ((P2OUT & CS_PIN) != 0){
+        cs_errors++;
+    }
+    if (received_count < MAX_BYTES){
+        received[received_count] = tagged;
+    }
+    received_count++;
+    CtrlByte((unsigned char)shifter, (tagged & 0x100) != 0);
+    CtrlAdvance(4);
+    shifter = 0x100;
+}
+
+//---------------------------------------------------------------
+// Name: UsciStep
+// Function: One byte time: finish the shift, start the next one from TXBUF
+//---------------------------------------------------------------
+static void UsciStep(void){
+
+    if (shifter <= 0xFF){
+        ShiftOut();
+    }
+    if (usci_txbuf <= 0xFF){
+        shifter = usci_txbuf;
+        usci_txbuf = 0x100;
+    }
+}
+
+//---------------------------------------------------------------
+// Name: UsciStat
+// Function: UCB0STAT read. Time passes while it is polled, so each read moves the USCI on by a byte
+//---------------------------------------------------------------
+static unsigned char UsciStat(void){
+
+    sigset_t block, old;
+    unsigned char stat;
+
+    sigemptyset(&block);
+    sigaddset(&block, SIGALRM);
+    sigprocmask(SIG_BLOCK, &block, &old);       // The interrupt may be polling too
+    UsciStep();
+    stat = ((shifter <= 0xFF) || (usci_txbuf <= 0xFF)) ? UCBUSY : 0;
+    sigprocmask(SIG_SETMASK, &old, 0);
+    return stat;
+}
+
+//---------------------------------------------------------------
+// Name: TxInterrupt
+// Function: Timer signal = one byte time, then the USCI TX interrupt if it is enabled and pending
+//---------------------------------------------------------------
+static void TxInterrupt(int sig){
+
+    (void)sig;
+    UsciStep();
+    if (((IE2 & UCB0TXIE) != 0) && ((IFG2 & UCB0TXIFG) != 0)){
+        CallInTransportISR();
+    }
+}
+
+// Script: each call is made on the transport and added to the expected bytes
+//------------------------------------------------------------------------------
+static void Expect(unsigned char data, unsigned char tag){
+
+    if (expected_count < MAX_BYTES){
+        expected[expected_count] = data | ((tag == TX_DATA) ? 0x100 : 0);
+    }
+    expected_count++;
+    if (tag == TX_COMMAND){
+        expected_commands++;
+        expected_last_command = data;
+    } else if (expected_last_command == WRITE_RAM){
+        expected_ram++;
+    }
+}
+
+static void Queue(unsigned char data, unsigned char tag){
+    TransportQueue(data, tag);
+    Expect(data, tag);
+}
+
+static void Command(unsigned char cmd, const unsigned char *args, unsigned int count){
+    unsigned int n;
+
+    Queue(cmd, TX_COMMAND);
+    for (n = 0; n < count; n++){
+        Queue(args[n], TX_DATA);
+    }
+}
+
+static void Block(unsigned int offset, unsigned int len, unsigned char mask){
+    unsigned int n;
+
+    TransportWriteBlock(&pattern[offset], len, mask);
+    for (n = 0; n < len; n++){
+        Expect(pattern[offset + n] ^ mask, TX_DATA);
+    }
+}
+
+static void Script(void){
+    static const unsigned char window_x[2] = {0x00, 0x18};
+    static const unsigned char window_y[4] = {0x00, 0x00, 0xC7, 0x00};
+    static const unsigned char counter_y[2] = {0x00, 0x00};
+    static const unsigned char entry[1] = {0x03};
+    unsigned int n;
+
+    TransportSelect();
+    Command(DATA_ENTRY_MODE_SETTING, entry, 1);
+    Command(SET_RAM_X_ADDRESS_START_END_POSITION, window_x, 2);
+    Command(SET_RAM_Y_ADDRESS_START_END_POSITION, window_y, 4);         // More parameters than ring slots
+    Command(SET_RAM_X_ADDRESS_COUNTER, window_x, 1);
+    Command(SET_RAM_Y_ADDRESS_COUNTER, counter_y, 2);
+    Command(WRITE_RAM, 0, 0);
+
+    Block(0, 1, 0x00);
+    Block(0, 200, 0xFF);                        // A RenderDisplayList half band
+    Block(3, 255, 0x00);                        // One whole piece
+    Block(7, 256, 0xFF);                        // Two pieces
+    Block(0, 600, 0x00);                        // Three
+    Block(0, 0, 0xFF);
+
+    Command(WRITE_RAM, 0, 0);                   // Queued behind a block still being sent
+    Block(1, 400, 0xFF);
+    Command(SET_RAM_Y_ADDRESS_COUNTER, counter_y, 2);
+    Command(WRITE_RAM, 0, 0);
+
+    TransportSetDC(TX_DATA);                    // Synchronous bytes, as StreamData
+    for (n = 0; n < 50; n++){
+        TransportWrite(pattern[n]);
+        Expect(pattern[n], TX_DATA);
+    }
+    Command(DATA_ENTRY_MODE_SETTING, entry, 1);
+    TransportDeselect();
+}
+
+//---------------------------------------------------------------
+// Name: Check
+// Function: Compare what left the shifter with the script
+// Returns: Number of problems found (reported)
+//---------------------------------------------------------------
+static unsigned int Check(unsigned int round, const CtrlStats *before){
+
+    unsigned int problems = 0;
+    unsigned int n;
+
+    if (received_count != expected_count){
+        printf("round %u: %u bytes sent, %u expected\n", round, received_count, expected_count);
+        problems++;
+    }
+    for (n = 0; (n < received_count) && (n < expected_count) && (n < MAX_BYTES); n++){
+        if (received[n] != expected[n]){
+            printf("round %u: byte %u is 0x%02X as %s, expected 0x%02X as %s\n", round, n,
+                   received[n] & 0xFF, (received[n] & 0x100) ? "data" : "command",
+                   expected[n] & 0xFF, (expected[n] & 0x100) ? "data" : "command");
+            problems++;
+            break;
+        }
+    }
+    if ((ctrl_stats.commands - before->commands) != expected_commands){
+        printf("round %u: controller decoded %lu commands, %lu sent\n", round,
+               ctrl_stats.commands - before->commands, expected_commands);
+        problems++;
+    }
+    if ((ctrl_stats.ram_bytes - before->ram_bytes) != expected_ram){
+        printf("round %u: controller took %lu RAM bytes, %lu sent\n", round,
+               ctrl_stats.ram_bytes - before->ram_bytes, expected_ram);
+        problems++;
+    }
+    if (cs_errors != 0){
+        printf("round %u: %lu bytes without CS\n", round, cs_errors);
+        problems++;
+    }
+    if ((TransportBusy() != 0) || ((P2OUT & CS_PIN) == 0) || ((IE2 & UCB0TXIE) != 0)){
+        printf("round %u: transport not idle after TransportDeselect\n", round);
+        problems++;
+    }
+    return problems;
+}
+
+int main(void){
+    struct sigaction action;
+    struct itimerval tick;
+    CtrlStats before;
+    unsigned int round;
+    unsigned int problems = 0;
+    unsigned long bytes = 0;
+    unsigned int n;
+
+    for (n = 0; n < sizeof(pattern); n++){
+        pattern[n] = (unsigned char)((n * 37) + (n >> 8));
+    }
+    CtrlReset();
+    InitTransport();
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = TxInterrupt;
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &action, 0);
+
+    for (round = 0; round < ROUNDS; round++){
+        tick.it_interval.tv_sec = 0;
+        tick.it_interval.tv_usec = 10 + (round * 37);           // Interrupt lands somewhere else each round
+        tick.it_value = tick.it_interval;
+        setitimer(ITIMER_REAL, &tick, 0);
+
+        before = ctrl_stats;
+        expected_count = 0;
+        expected_commands = 0;
+        expected_ram = 0;
+        expected_last_command = 0;
+        received_count = 0;
+        Script();
+        problems += Check(round, &before);
+        bytes += received_count;
+    }
+
+    memset(&tick, 0, sizeof(tick));
+    setitimer(ITIMER_REAL, &tick, 0);
+
+    printf("usci ring: %u rounds, %lu bytes, %s\n", ROUNDS, bytes,
+           (problems == 0) ? "every byte in order with the right D/C and CS" : "FAILED");
+    return (problems == 0) ? 0 : 1;
+}
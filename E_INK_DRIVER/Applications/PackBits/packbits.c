@@ -0,0 +1,170 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: packbits.c
+//                  Host side PackBits encoder for LCDImager bitmaps
+//                          Author: Sonikku
+//
+//              Reads the C array written by LCDImager (every 0xNN token in the file, in order), compresses it with
+//              PackBits and writes a C array for LoadPackedBitmap() / ShowPackedImage() to stdout. The result is
+//              decoded again and compared with the input before anything is written, so a bad encode can't slip
+//              into the firmware.
+//
+//              Build:  cc -O2 -o packbits packbits.c
+//              Usage:  packbits <LCDImager .c file> <array name>  >  image.c
+//
+//              Format: header 0..127   - copy the next header + 1 bytes
+//                      header 129..255 - repeat the next byte 257 - header times
+//                      header 128      - never emitted
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define IMAGE_SIZE 5000                         // (200 / 8) * 200
+#define MAX_PACKED (IMAGE_SIZE + (IMAGE_SIZE / 128) + 1)
+
+// Name: ReadImage
+// Function: Collect every 0xNN token from an LCDImager source file
+// Returns: Number of bytes read, or -1 on error
+//---------------------------------------------------------------------------------
+static int ReadImage(const char *path, unsigned char *image){
+    FILE *f;
+    int c;
+    int prev = 0;
+    int count = 0;
+    char hex[3];
+
+    f = fopen(path, "r");
+    if (f == NULL){
+        return -1;
+    }
+
+    while ((c = fgetc(f)) != EOF){
+        if ((prev == '0') && ((c == 'x') || (c == 'X'))){
+            hex[0] = (char)fgetc(f);
+            hex[1] = (char)fgetc(f);
+            hex[2] = 0;
+            if (!isxdigit((unsigned char)hex[0]) || !isxdigit((unsigned char)hex[1])){
+                fclose(f);
+                return -1;
+            }
+            if (count == IMAGE_SIZE){
+                fclose(f);
+                return -1;                      // Too big for the panel
+            }
+            image[count++] = (unsigned char)strtol(hex, NULL, 16);
+            c = 0;
+        }
+        prev = c;
+    }
+
+    fclose(f);
+    return count;
+}
+
+// Name: Pack
+// Function: PackBits encode. Runs of 3 or more become repeat records
+// Returns: Packed length
+//---------------------------------------------------------------------------------
+static int Pack(const unsigned char *src, int len, unsigned char *dst){
+    int i = 0;
+    int out = 0;
+    int run;
+    int lit;
+
+    while (i < len){
+        run = 1;
+        while ((i + run < len) && (src[i + run] == src[i]) && (run < 128)){
+            run++;
+        }
+        if (run >= 3){
+            dst[out++] = (unsigned char)(257 - run);
+            dst[out++] = src[i];
+            i += run;
+            continue;
+        }
+
+        lit = 0;
+        while ((i + lit < len) && (lit < 128)){
+            if ((i + lit + 2 < len) && (src[i + lit] == src[i + lit + 1]) && (src[i + lit] == src[i + lit + 2])){
+                break;                          // A run starts here
+            }
+            lit++;
+        }
+        dst[out++] = (unsigned char)(lit - 1);
+        memcpy(&dst[out], &src[i], lit);
+        out += lit;
+        i += lit;
+    }
+
+    return out;
+}
+
+// Name: Unpack
+// Function: Reference decoder, same logic as LoadPackedBitmap()
+// Returns: Unpacked length
+//---------------------------------------------------------------------------------
+static int Unpack(const unsigned char *src, int len, unsigned char *dst){
+    int i = 0;
+    int out = 0;
+    int count;
+    unsigned char header;
+
+    while ((i < len) && (out < IMAGE_SIZE)){
+        header = src[i++];
+        if (header < 128){
+            count = header + 1;
+            while ((count-- > 0) && (out < IMAGE_SIZE)){
+                dst[out++] = src[i++];
+            }
+        } else if (header > 128){
+            count = 257 - header;
+            while ((count-- > 0) && (out < IMAGE_SIZE)){
+                dst[out++] = src[i];
+            }
+            i++;
+        }
+    }
+
+    return out;
+}
+
+int main(int argc, char *argv[]){
+    unsigned char image[IMAGE_SIZE];
+    unsigned char packed[MAX_PACKED];
+    unsigned char check[IMAGE_SIZE];
+    int len;
+    int plen;
+    int n;
+
+    if (argc != 3){
+        fprintf(stderr, "usage: %s <LCDImager .c file> <array name>\n", argv[0]);
+        return 2;
+    }
+
+    len = ReadImage(argv[1], image);
+    if (len != IMAGE_SIZE){
+        fprintf(stderr, "%s: expected %d bytes of image data, found %d\n", argv[1], IMAGE_SIZE, len);
+        return 1;
+    }
+
+    plen = Pack(image, len, packed);
+    if ((Unpack(packed, plen, check) != IMAGE_SIZE) || (memcmp(image, check, IMAGE_SIZE) != 0)){
+        fprintf(stderr, "%s: round trip failed\n", argv[1]);
+        return 1;
+    }
+
+    printf("/* PackBits image for LoadPackedBitmap() - %d bytes, was %d */\n\n", plen, len);
+    printf("static const unsigned char %s []={", argv[2]);
+    for (n = 0; n < plen; n++){
+        if ((n % 16) == 0){
+            printf("\n            ");
+        }
+        printf("0x%02X%s", packed[n], (n == plen - 1) ? "};\n" : ",");
+    }
+
+    fprintf(stderr, "%s: %d -> %d bytes (%d%%), round trip OK\n", argv[1], len, plen, (plen * 100) / len);
+    return 0;
+}
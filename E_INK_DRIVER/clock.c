@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: clock.c
+//                  CPU clock scaling
+//                          Author: Sonikku
+//
+//              The DCO runs at the calibrated 16 MHz and SMCLK is DCO / 8 = 2 MHz at all times. MCLK is switched
+//              between DCO / 1 (fast) for SPI bursts, decompression and rendering, and DCO / 8 (slow) for the rest:
+//              one BCSCTL2 write, no DCO re-lock, so a switch costs a few cycles and can be done per call.
+//
+//              Waits don't depend on MCLK: WaitBusy, Delay and the scheduler sleep in LPM3, where MCLK and the
+//              DCO are off and Timer0_A runs from ACLK. WaitBusy still drops to the slow clock so the wake up
+//              and the ISRs around a refresh don't run at 16 MHz for nothing.
+//
+//              Switches nest without any RAM - the previous setting is kept by the caller:
+//
+//                  unsigned char clock;
+//                  clock = ClockFast();
+//                  ...
+//                  ClockRestore(clock);
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "clock.h"
+
+#define CLOCK_FAST  (DIVM_0 | DIVS_3)           // BCSCTL2: MCLK = DCO, SMCLK = DCO / 8
+#define CLOCK_SLOW  (DIVM_3 | DIVS_3)           // BCSCTL2: MCLK = DCO / 8, SMCLK = DCO / 8
+
+#define FALLBACK_LED            BIT0            // LED1 (P1.0) on the LaunchPad
+#define FALLBACK_BLINK_CYCLES   25000UL         // 200 ms at the fallback's slow MCLK (1 MHz / 8)
+
+
+//------------------------------------------------------------------------
+// Name: InitClock
+// Function: Lock the DCO to the calibrated 16 MHz, start on the slow clock
+//           If the 16 MHz calibration has been erased, the DCO is set from the 1 MHz one instead (or left at its
+//           reset setting, ~1.1 MHz, if that is gone too) and LED1 blinks three times. Everything then runs about 16
+//           times slower: SPI and the CPU still work, the VLO keeps its nominal rate (CalibrateTimer rejects the
+//           measurement) and the profiler's UART is off baud
+//           Call first thing in main(), before anything that depends on SMCLK
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void InitClock(void){
+    unsigned char n;
+
+    BCSCTL2 = CLOCK_SLOW;                        // Divide first, so MCLK never runs above the target
+
+    if ((CALBC1_16MHZ == 0xFF) || (CALDCO_16MHZ == 0xFF)){
+        if ((CALBC1_1MHZ != 0xFF) && (CALDCO_1MHZ != 0xFF)){
+            DCOCTL = 0;
+            BCSCTL1 = CALBC1_1MHZ;
+            DCOCTL = CALDCO_1MHZ;
+        }
+        P1DIR |= FALLBACK_LED;
+        for (n = 0; n < 6; n++){
+            P1OUT ^= FALLBACK_LED;
+            __delay_cycles(FALLBACK_BLINK_CYCLES);
+        }
+        return;
+    }
+
+    DCOCTL = 0;                                  // Select lowest DCOx and MODx settings
+    BCSCTL1 = CALBC1_16MHZ;                      // Set range
+    DCOCTL = CALDCO_16MHZ;                       // Set DCO step + modulation
+}
+
+//------------------------------------------------------------------------
+// Name: ClockFast
+// Function: MCLK to 16 MHz
+// Arguments: void
+// Returns: Previous setting, for ClockRestore
+//------------------------------------------------------------------------
+unsigned char ClockFast(void){
+    unsigned char setting;
+
+    setting = BCSCTL2;
+    BCSCTL2 = CLOCK_FAST;
+    return setting;
+}
+
+//------------------------------------------------------------------------
+// Name: ClockSlow
+// Function: MCLK to 2 MHz
+// Arguments: void
+// Returns: Previous setting, for ClockRestore
+//------------------------------------------------------------------------
+unsigned char ClockSlow(void){
+    unsigned char setting;
+
+    setting = BCSCTL2;
+    BCSCTL2 = CLOCK_SLOW;
+    return setting;
+}
+
+//------------------------------------------------------------------------
+// Name: ClockRestore
+// Function: Go back to the MCLK setting returned by ClockFast / ClockSlow
+// Arguments: Setting
+// Returns: void
+//------------------------------------------------------------------------
+void ClockRestore(unsigned char setting){
+    BCSCTL2 = setting;
+}
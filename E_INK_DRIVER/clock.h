@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for clock.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+// Definitions
+//--------------------
+
+// DCO locked to the factory calibrated 16 MHz (needs VCC >= 3.3 V, the LaunchPad gives 3.6 V)
+// Only the MCLK divider changes at run time, so SMCLK - and with it the USCI bit rates, the VLO calibration
+// and the profiler time base - is the same whatever the CPU is doing
+#define CLOCK_DCO_HZ            16000000UL
+#define CLOCK_MCLK_FAST_HZ      CLOCK_DCO_HZ            // Streaming, decompression, rendering
+#define CLOCK_MCLK_SLOW_HZ      (CLOCK_DCO_HZ / 8)      // Everything else (2 MHz, the largest divider)
+#define CLOCK_SMCLK_HZ          (CLOCK_DCO_HZ / 8)      // Fixed
+
+// __delay_cycles() counts MCLK cycles: size a delay for the fast clock and it can only get longer
+#define CLOCK_CYCLES_PER_US     (CLOCK_MCLK_FAST_HZ / 1000000UL)
+
+// Function Prototypes
+//--------------------
+void InitClock(void);
+unsigned char ClockFast(void);
+unsigned char ClockSlow(void);
+void ClockRestore(unsigned char setting);
+
+#endif /* CLOCK_H_ */
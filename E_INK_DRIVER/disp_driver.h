@@ -36,22 +36,104 @@
 #define TERMINATE_FRAME_READ_WRITE                  0xFF
 
 
+// Refresh modes (SetRefreshMode)
+//--------------------
+#define REFRESH_FULL                                0           // Full waveform - flashes, clears ghosting
+#define REFRESH_PARTIAL                             1           // Partial waveform - fast, no flashing, may ghost
+#define REFRESH_SCROLL                              2           // Partial timing, drives every pixel whatever the old image
+                                                                // (HARDWARE_SCROLL, selected by ScrollDisplay)
+
+
+#define BLANK_BITMAP                                0           // Pass to LoadBitmap() or LoadPackedBitmap() for an all white image
+
+
+// Command sequences (RunSequence)
+// Each step is: control byte, command, payload bytes, [delay in ms if SEQ_DELAY]
+// The control byte holds the payload length and flags. A control byte of SEQ_END ends the sequence
+//--------------------
+#define SEQ_LENGTH_MASK                             0x1F        // Payload bytes (0 - 31)
+#define SEQ_DELAY                                   0x20        // A delay byte (ms) follows the payload
+#define SEQ_WAIT_BUSY                               0x40        // Wait for BUSY to clear after the step
+#define SEQ_END                                     0x80
+
+
+// Dirty rectangle, in byte columns (0 - 24) and rows (0 - 199)
+// Empty when x_start > x_end (see ClearDirty)
+//--------------------
+typedef struct {
+    unsigned char x_start;
+    unsigned char x_end;
+    unsigned char y_start;
+    unsigned char y_end;
+} DirtyRect;
+
+
+// Driver options
+//--------------------
+#define BUSY_TIMEOUT_MS                             5000        // Longest a BUSY wait may sleep before giving up
+//#define BAND_SIGNATURES                                         // CRC-8 per band of rows per RAM bank, lets LoadBitmap skip unchanged bands
+                                                                // when the bank content isn't a known bitmap. Costs 2 * SIGNATURE_BANDS + 1
+                                                                // bytes RAM: 9 with 4 bands, which fills the last of the 512 with the GPIO
+                                                                // transport and doesn't fit with USCI_B0 or the other RAM options
+#define SIGNATURE_BAND_ROWS                         50          // Rows per band (must divide the 200 panel rows)
+#define SIGNATURE_BANDS                             (200 / SIGNATURE_BAND_ROWS)
+
+#if SIGNATURE_BANDS > 4
+#error "SIGNATURE_BANDS of both banks must fit in an 8 bit validity mask"
+#endif
+
+//#define DRIVER_STATS                                            // Count what the register shadow saved, per frame (GetShadowStats)
+                                                                // Costs 8 bytes RAM
+
+//#define HARDWARE_SCROLL                                         // ScrollDisplay(): move the picture with the gate scan start position
+                                                                // and send only the new rows. Costs 2 bytes RAM
+
+
 // Function Prototypes
 //--------------------
 void InitDriver(void);
 void InitDisplay(void);
 void PollBusy(void);
+unsigned char WaitBusy(unsigned int timeout_ms);
+unsigned char CallInBusyISR(void);
 void SerialOut(unsigned char data);
 void WriteCommand(unsigned char cmd);
+void SetDataEntryMode(unsigned char mode);
+void RunSequence(const unsigned char *seq);
+void GetShadowStats(unsigned int *bytes, unsigned int *waits);
 void WriteData(unsigned char data);
+void BeginDataStream(void);
+void StreamData(unsigned char data);
+void StreamDataBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask);
+void EndDataStream(void);
+void WriteDataBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask);
+void WriteDataFill(unsigned char data, unsigned int len);
 void WriteLUT(const unsigned char *lutdata);
 void DoDisplayTest(void);
 void DisplayFrame(void);
+void StartDisplayFrame(void);
+unsigned char DisplayBusy(void);
+void SetFrameDoneCallback(void (*callback)(void));
 void MapRAMToDisplay(int x_start, int y_start, int x_end, int y_end);
 void SetLocation(int x, int y);
 void BlankScreen(void);
 void LoadBitmap(const unsigned char *bmp);
+void ShowImage(const unsigned char *bmp);
+void LoadPackedBitmap(const unsigned char *packed);
+void ShowPackedImage(const unsigned char *packed);
 void LoadText(unsigned int x, unsigned int y, unsigned char height);
+void LoadBand(unsigned int y, unsigned char rows);
+void BeginScreenStream(void);
+void SetRefreshMode(unsigned char mode);
+unsigned char GetRefreshMode(void);
+void LoadWindow(const unsigned char *src, int x_start, int y_start, int x_end, int y_end);
+void ClearDirty(DirtyRect *rect);
+void MergeDirty(DirtyRect *rect, unsigned char x_start, unsigned char y_start, unsigned char x_end, unsigned char y_end);
+unsigned char IsDirty(const DirtyRect *rect);
+unsigned char FindBitmapChanges(const unsigned char *old_bmp, const unsigned char *new_bmp, DirtyRect *rect);
+#ifdef HARDWARE_SCROLL
+void ScrollDisplay(unsigned char rows);
+#endif
 
 
 #endif /* DISP_DRIVER_H_ */
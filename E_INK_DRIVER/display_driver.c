@@ -17,6 +17,10 @@
 #include <msp430.h>
 #include "disp_driver.h"
 #include "graphlib.h"
+#include "spi_transport.h"
+#include "timer.h"
+#include "profile.h"
+#include "clock.h"
 
 
 
@@ -40,22 +44,123 @@ const unsigned char lut_partial_update[] ={
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
+#ifdef HARDWARE_SCROLL
+// The partial waveform with the same drive for 0->0 as for 1->0 and for 1->1 as for 0->1 (two bits per transition,
+// in that order from the top, as in the last phases of lut_full_update). The old image isn't looked at, which a scroll
+// needs: the other bank holds the picture before the move, so it doesn't match the glass row for row
+const unsigned char lut_scroll_update[] ={
+    0x11, 0x99, 0x99, 0x88, 0x99, 0x99, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x44, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#endif
+
+// Command sequences (see RunSequence)
+//---------------------------------------------------
+const unsigned char init_sequence[] ={
+    3, DRIVER_OUTPUT_CONTROL, (DISPLAY_Y_SIZE - 1) & 0xFF, ((DISPLAY_Y_SIZE - 1) >> 8) & 0xFF, 0x00,     // MUX, scan G0 -> G299
+    3, BOOSTER_SOFT_START_CONTROL, 0xD7, 0xD6, 0x9D,
+    1, WRITE_VCOM_REGISTER, 0xA8,                       // VCOM 7C
+    1, SET_DUMMY_LINE_PERIOD, 0x1A,                     // 4 dummy lines per gate
+    1, SET_GATE_TIME, 0x08,                             // 2us per line
+    SEQ_END
+};
+
+const unsigned char refresh_sequence[] ={
+    1, DISPLAY_UPDATE_CONTROL_2, 0xC4,
+    0, MASTER_ACTIVATION,
+    0, TERMINATE_FRAME_READ_WRITE,
+    SEQ_END
+};
+
 // Definitions on GPIO pins for display interfacing
 //---------------------------------------------------
 
 
 #define BUSY_IN BIT1            // P1.1 as input
 #define RESET BIT2              // P1.2 as output
-#define D_C BIT4                // P1.4 as output
-#define CS  BIT5                // P1.5 as output
-#define CLK BIT0                // P2.0 as output
-#define DATA BIT1               // P2.1 as output
+                                // CS, D/C, CLK and DATA belong to the transport, see spi_transport.c
+
 
+// Driver state
+//------------------
+volatile unsigned char frame_pending;           // 1 while an asynchronous refresh is running (cleared from the BUSY ISR)
+void (*frame_done_callback)(void);              // Called once a refresh completes, may be 0
+
+// The controller has two RAM banks and toggles between them on every MASTER_ACTIVATION
+// Remember which flash bitmap each bank holds, so a new bitmap can be diffed against it
+// The flags share one byte (RAM is short), none of them is touched by an ISR
+const unsigned char *bank_content[2];           // Bitmap last loaded into each bank (BLANK_BITMAP = white)
+unsigned char bank_state;                       // BANK_KNOWN(n) | BANK_PACKED(n) | BANK_GLASS_SYNCED | BANK_RAM | BANK_PAIRED
+
+#define BANK_KNOWN(n)       (0x01 << (n))       // bank_content[n] is valid
+#define BANK_PACKED(n)      (0x04 << (n))       // bank_content[n] is a PackBits image (can't be diffed)
+#define BANK_GLASS_SYNCED   0x10                // Clear until the first refresh after reset - until then the
+                                                // "old" bank is random and doesn't match the glass
+#define BANK_RAM            0x20                // Set = WRITE_RAM currently goes to bank 1
+#define RAM_BANK            ((bank_state >> 5) & 1)
+#define BANK_PAIRED         0x40                // Both banks hold the same picture (ScrollDisplay), cleared by any RAM write
+
+// Register shadow: whether the RAM window is the whole panel, and the data entry mode and LUT sent, so settings that
+// wouldn't change anything are not sent again. Cleared by InitDisplay (controller reset). Only the full panel window is
+// remembered and the address counter not at all: every window the shadow saved in EinkSim was the full panel one, and
+// the counter never matched (WRITE_RAM moves it), so those 6 bytes of RAM bought nothing
+unsigned char shadow_valid;                     // SHADOW_FULL_WINDOW | SHADOW_ENTRY_MODE, entry mode, LUT
+
+#define SHADOW_FULL_WINDOW  0x01                // RAM window is 0, 0 .. DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1
+#define SHADOW_ENTRY_MODE   0x04
+#define SHADOW_MODE_SHIFT   4                   // Data entry mode sent last (3 bits)
+#define SHADOW_MODE_MASK    0x70
+#define SHADOW_LUT_PARTIAL  0x80                // Partial waveform loaded (else full), always valid
+
+#ifdef HARDWARE_SCROLL
+// Display row 0 shows RAM row scroll_origin (GATE_SCAN_START_POSITION). SetLocation and MapRAMToDisplay take display
+// rows and move them by the origin, so nothing above them needs to know about scrolling
+unsigned char scroll_origin;
+unsigned char scroll_lut;                       // 1 = lut_scroll_update loaded (REFRESH_SCROLL)
+#endif
+
+#ifdef DRIVER_STATS
+unsigned int saved_bytes;                       // Saved while the next frame is being loaded
+unsigned int saved_waits;
+unsigned int frame_saved_bytes;                 // Latched by StartDisplayFrame
+unsigned int frame_saved_waits;
+#define SHADOW_SAVED(bytes, waits)  {saved_bytes += (bytes); saved_waits += (waits);}
+#else
+#define SHADOW_SAVED(bytes, waits)
+#endif
+
+#ifdef BAND_SIGNATURES
+// Without a shadow frame buffer, each bank is summarised as one CRC-8 per band of rows
+unsigned char band_signature[2][SIGNATURE_BANDS];
+unsigned char band_valid;                       // BAND_VALID(bank, n) set = band_signature[bank][n] is valid
+
+#define BAND_VALID(bank, n)     (0x01 << (((bank) * SIGNATURE_BANDS) + (n)))
+
+// CRC-8 (x^8 + x^2 + x + 1) by nibble - 16 bytes of flash instead of 256
+const unsigned char crc8_nibble[16] ={
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+    0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+#endif
+
+// Local Function Prototypes
+//---------------------------
+static void ForgetContent(unsigned int y_start, unsigned int y_end);
+static void ShowContent(const unsigned char *img, void (*load)(const unsigned char *img), unsigned char packed);
+static void StreamTextRow(unsigned char *row);
+static void LoadBitmapRect(const unsigned char *bmp, const DirtyRect *rect);
+#ifdef BAND_SIGNATURES
+static unsigned char BandSignature(const unsigned char *bmp, unsigned char band);
+static void UpdateSignatures(const unsigned char *bmp, unsigned char send);
+#endif
 
 // Other definitions
 //------------------
 #define DISPLAY_X_SIZE 200
 #define DISPLAY_Y_SIZE 200
+#define DISPLAY_RAM_SIZE ((DISPLAY_X_SIZE / 8) * DISPLAY_Y_SIZE)     // Bytes in one full controller RAM image
 
 // Functions
 //-------------
@@ -67,11 +172,8 @@ void InitDriver(void){
 
     // Initialise all the pins
 
-    P2OUT &= ~CLK;              // CLK LOW
-    P2OUT &= ~DATA;             // DATA LOW
+    InitTransport();            // CS HIGH (inactive state), D/C LOW, CLK/DATA or USCI_B0 set up
     P1OUT |= RESET;             // RESET HIGH
-    P1OUT |= CS;                // CHIP SELECT HIGH (inactive state)
-    P1OUT &= ~D_C;              // DATA/COMMAND pin LOW
 
 }
 
@@ -82,10 +184,11 @@ void InitDriver(void){
 // Returns: void
 //---------------------------------------------------------------------
 void Reset(void){
+    TransportDeselect();        // Let queued bytes finish first
     P1OUT &= ~RESET;            // Reset LOW
-    __delay_cycles(30);
+    __delay_cycles(30 * CLOCK_CYCLES_PER_US);       // 30 us at 16 MHz, longer on the slow clock
     P1OUT |= RESET;             // Reset HIGH
-    __delay_cycles(80);
+    __delay_cycles(80 * CLOCK_CYCLES_PER_US);
 }
 
 //---------------------------------------------------------------------
@@ -96,133 +199,580 @@ void Reset(void){
 //----------------------------------------------------------------------
 void InitDisplay(void){
 
+        unsigned char clock;
+
+        PROFILE_BEGIN(PROF_INIT);
+        clock = ClockFast();
         Reset();
+        shadow_valid = 0;                                   // Controller registers are back to their defaults
+#ifdef HARDWARE_SCROLL
+        scroll_origin = 0;
+        scroll_lut = 0;
+#endif
         PollBusy();
-        WriteCommand(DRIVER_OUTPUT_CONTROL);
-        WriteData((DISPLAY_Y_SIZE - 1) & 0xFF);             // MUX setting
-        WriteData(((DISPLAY_Y_SIZE - 1) >> 8) & 0xFF);      // MUX setting bit 8
-        WriteData(0x00);                                    // Scan Direction G0 -> G299
-
-        WriteCommand(BOOSTER_SOFT_START_CONTROL);
-        WriteData(0xD7);
-        WriteData(0xD6);
-        WriteData(0x9D);
-        WriteCommand(WRITE_VCOM_REGISTER);
-        WriteData(0xA8);                     // VCOM 7C
-        WriteCommand(SET_DUMMY_LINE_PERIOD);
-        WriteData(0x1A);                     // 4 dummy lines per gate
-        WriteCommand(SET_GATE_TIME);
-        WriteData(0x08);                     // 2us per line
-        WriteCommand(DATA_ENTRY_MODE_SETTING);
-        WriteData(0x03);                     // X increment; Y increment
-        WriteLUT(lut_full_update);       // Now depending on the update mode, a look-up-table is written // TODO - determine what is optimal for this use case
+        RunSequence(init_sequence);
+        SetDataEntryMode(0x03);              // X increment; Y increment
+        WriteLUT(lut_full_update);       // Always start with the full waveform, SetRefreshMode() switches at runtime
+        bank_state = 0;                  // RAM contents are unknown after reset, writes go to bank 0, glass not synced
+#ifdef BAND_SIGNATURES
+        band_valid = 0;
+#endif
+        ClockRestore(clock);
+        PROFILE_END(PROF_INIT);
 
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 // Name: DisplayText
 // Function: Takes the small text buffer and builds it into the main display buffer write at the desired line location
+//           The text rows sent are left transposed in frame_buffer (see StreamTextRow): draw the text again
+//           (InitFrameBuffer, OutString) before another LoadText
 // Parameters: Location on display where the text must appear (x; y)
 //             Font height (0 = single; 1 = double)
 //             Note that this leverages the display hardware, therefore using minimal resources on the micro
 //----------------------------------------------------------------------------------------------------------------------
 void LoadText(unsigned int x, unsigned int y, unsigned char height){
 
-    unsigned char linecnt;
-    unsigned int g = 0;
-    unsigned char h = 0;
-    unsigned char temp = 0;
-    unsigned char bitpos = 1;
-    unsigned char bpos = 0x80;
-    unsigned int target_addr = 0;
-    unsigned char frame_data;
+    unsigned char clock;
 
+    PROFILE_BEGIN(PROF_UPLOAD);
+    clock = ClockFast();
     MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
     SetLocation(x, y);
     WriteCommand(WRITE_RAM);
+    BeginDataStream();
+    if (height > 0){
+        ForgetContent(y, y + 15);       // Bank no longer holds a plain bitmap
+    } else {
+        ForgetContent(y, y + 7);
+    }
 
-
-    // Need to write 8 horizontal lines
+    // Need to write 8 horizontal lines per text row
     // Each horizontal line is 25 bytes of data
-    for (linecnt = 0; linecnt < 8; linecnt++){
-        for (g = 0; g < 25; g++){
-            for (h = 0; h < 8; h++){
-                frame_data = frame_buffer[target_addr];           // get frame buffer byte
-                if ((frame_data & bitpos) == bitpos){
-                    temp |= bpos;
-                } else {
-                    temp &= ~bpos;
-                }
-                target_addr++;
-                bpos >>= 1;
-            }
-            WriteData(~temp);
-            bpos = 0x80;
+    StreamTextRow(&frame_buffer[0]);
+    if (height > 0){
+        StreamTextRow(&frame_buffer[DISPLAY_X_SIZE]);
+    }
+
+    EndDataStream();
+    ClockRestore(clock);
+    PROFILE_END(PROF_UPLOAD);
 
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Name: LoadBand
+// Function: Send the first rows of a horizontal band (see BlitChar) to the display at line y
+//           The band is already in panel order, so it goes out as one burst with no conversion
+// Parameters: Display line of the first row, number of rows (up to BAND_ROWS)
+//----------------------------------------------------------------------------------------------------------------------
+void LoadBand(unsigned int y, unsigned char rows){
+
+    unsigned char clock;
+
+    PROFILE_BEGIN(PROF_UPLOAD);
+    clock = ClockFast();
+    MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
+    SetLocation(0, y);
+    WriteCommand(WRITE_RAM);
+    WriteDataBlock(frame_buffer, (unsigned int)rows * (DISPLAY_X_SIZE / 8), 0xFF);
+    ForgetContent(y, y + rows - 1);
+    ClockRestore(clock);
+    PROFILE_END(PROF_UPLOAD);
+
+}
+
+#ifdef HARDWARE_SCROLL
+//----------------------------------------------------------------------------------------------------------------------
+// Name: ScrollDisplay
+// Function: Move the picture up and bring new rows in at the bottom (ticker, log view)
+//           The controller moves the picture (gate scan start position), so only the new rows are sent: once into
+//           each RAM bank, as the banks take turns. The second copy can only go in once the refresh is over, so this
+//           returns after the refresh (sleeping in WaitBusy)
+//
+//           The refresh uses REFRESH_SCROLL: the partial waveform only drives pixels that differ between the banks,
+//           and after a move the banks no longer line up with the glass. Select the waveform wanted afterwards
+// Parameters: Number of rows (1 - BAND_ROWS), taken from the top of the frame_buffer band (as LoadBand)
+//----------------------------------------------------------------------------------------------------------------------
+void ScrollDisplay(unsigned char rows){
+
+    unsigned int origin;
+    unsigned char shown;
+
+    if ((rows == 0) || (rows > BAND_ROWS)){
+        return;
+    }
+
+    // The bank written next holds the picture from two refreshes ago. Bring it up to the glass first, which needs
+    // the driver to know what is on the glass: a ShowImage / ShowPackedImage picture or an earlier scroll
+    shown = RAM_BANK ^ 1;
+    if (((bank_state & BANK_PAIRED) == 0) && ((bank_state & (BANK_GLASS_SYNCED | BANK_KNOWN(shown))) == (BANK_GLASS_SYNCED | BANK_KNOWN(shown)))){
+        if ((bank_state & BANK_PACKED(shown)) != 0){
+            LoadPackedBitmap(bank_content[shown]);
+        } else {
+            LoadBitmap(bank_content[shown]);
         }
+    }
 
-        target_addr = 0;
-        bitpos <<= 1;
+    SetRefreshMode(REFRESH_SCROLL);
 
+    origin = scroll_origin + rows;
+    if (origin >= DISPLAY_Y_SIZE){
+        origin -= DISPLAY_Y_SIZE;
     }
+    scroll_origin = origin;
 
-    target_addr = 200;
-    bitpos = 1;
-    bpos = 0x80;
+    // With the new origin, the bottom display rows are the RAM rows that just left the top
+    LoadBand(DISPLAY_Y_SIZE - rows, rows);
+    ForgetContent(0, DISPLAY_Y_SIZE - 1);           // Every row has moved
 
-    if (height > 0){
-        for (linecnt = 0; linecnt < 8; linecnt++){
-            for (g = 0; g < 25; g++){
-                for (h = 0; h < 8; h++){
-                    frame_data = frame_buffer[target_addr];           // get frame buffer byte
-                    if ((frame_data & bitpos) == bitpos){
-                        temp |= bpos;
-                    } else {
-                        temp &= ~bpos;
-                    }
-                    target_addr++;
-                    bpos >>= 1;
-                }
-                WriteData(~temp);
-                bpos = 0x80;
-            }
+    WriteCommand(GATE_SCAN_START_POSITION);
+    WriteData(origin & 0xFF);
+    WriteData((origin >> 8) & 0xFF);
+    StartDisplayFrame();
+
+    LoadBand(DISPLAY_Y_SIZE - rows, rows);          // Same rows into the other bank (waits for the refresh)
+    ForgetContent(0, DISPLAY_Y_SIZE - 1);
+    bank_state |= BANK_PAIRED;
+
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// Name: BeginScreenStream
+// Function: Open a data stream over the whole display RAM, top line first. Follow with one full image (5000 bytes)
+//           (StreamData / StreamDataBlock) and EndDataStream()
+// Parameters: void
+//----------------------------------------------------------------------------------------------------------------------
+void BeginScreenStream(void){
+
+    MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
+    SetLocation(0, 0);
+    WriteCommand(WRITE_RAM);
+    BeginDataStream();
+    ForgetContent(0, DISPLAY_Y_SIZE - 1);
+
+}
 
-            target_addr = 200;
-            bitpos <<= 1;
+//----------------------------------------------------------------------------------------------------------------------
+// Name: StreamTextRow
+// Function: Send one 8 pixel high text row (200 vertical bytes, bit 0 = top) as 8 lines of 25 horizontal bytes
+//
+//           Each 8 x 8 block is flipped about its anti-diagonal in place (FlipBlock), after which the horizontal byte
+//           for line L of block g sits at row[g * 8 + 7 - L], and the lines are streamed from there. The row is left
+//           flipped: there is no RAM for a copy, and flipping it back would double the cost
+// Parameters: First byte of the text row in frame_buffer
+//----------------------------------------------------------------------------------------------------------------------
+static void StreamTextRow(unsigned char *row){
+
+    unsigned char g;
+    unsigned char line;
+    unsigned char *block;
+
+    block = row;
+    for (g = 0; g < (DISPLAY_X_SIZE / 8); g++){
+        FlipBlock(block);
+        block += 8;
+    }
+
+    for (line = 0; line < 8; line++){
+        block = row + (7 - line);
+        for (g = 0; g < (DISPLAY_X_SIZE / 8); g++){
+            StreamData(~(*block));
+            block += 8;
         }
     }
 
 }
 
 
+
+//----------------------------------------------------------------------
+// Name: SetRefreshMode
+// Function: Select the waveform used by the next DisplayFrame()
+//           The LUT is only rewritten when the mode actually changes
+// Parameters: REFRESH_FULL, REFRESH_PARTIAL or REFRESH_SCROLL (HARDWARE_SCROLL only)
+//----------------------------------------------------------------------
+void SetRefreshMode(unsigned char mode){
+
+    if (mode == GetRefreshMode()){
+        SHADOW_SAVED(31, 0);                // LUT already loaded
+        return;
+    }
+
+#ifdef HARDWARE_SCROLL
+    scroll_lut = 0;
+    if (mode == REFRESH_SCROLL){
+        WriteLUT(lut_scroll_update);
+        shadow_valid &= ~SHADOW_LUT_PARTIAL;
+        scroll_lut = 1;
+        return;
+    }
+#endif
+    if (mode == REFRESH_PARTIAL){
+        WriteLUT(lut_partial_update);
+        shadow_valid |= SHADOW_LUT_PARTIAL;
+    } else {
+        WriteLUT(lut_full_update);
+        shadow_valid &= ~SHADOW_LUT_PARTIAL;
+    }
+}
+
+//----------------------------------------------------------------------
+// Name: GetRefreshMode
+// Function: Report the waveform currently loaded
+// Returns: REFRESH_FULL, REFRESH_PARTIAL or REFRESH_SCROLL
+//----------------------------------------------------------------------
+unsigned char GetRefreshMode(void){
+#ifdef HARDWARE_SCROLL
+    if (scroll_lut != 0){
+        return REFRESH_SCROLL;
+    }
+#endif
+    return ((shadow_valid & SHADOW_LUT_PARTIAL) != 0) ? REFRESH_PARTIAL : REFRESH_FULL;
+}
+
+//----------------------------------------------------------------------
+// Name: LoadWindow
+// Function: Load a rectangular LCDImager bitmap into part of display RAM
+//           Use with REFRESH_PARTIAL to update a counter or line of text without a full flash
+// Parameters: Bitmap (rows of (x_end - x_start + 1) / 8 bytes), window corners in pixels
+//             x_start must be a multiple of 8 and x_end one less than a multiple of 8
+//----------------------------------------------------------------------
+void LoadWindow(const unsigned char *src, int x_start, int y_start, int x_end, int y_end){
+
+    unsigned int len;
+    unsigned char clock;
+
+    len = (unsigned int)(((x_end >> 3) - (x_start >> 3)) + 1) * (unsigned int)((y_end - y_start) + 1);
+
+    PROFILE_BEGIN(PROF_UPLOAD);
+    clock = ClockFast();
+    MapRAMToDisplay(x_start, y_start, x_end, y_end);
+    SetLocation(x_start, y_start);
+    WriteCommand(WRITE_RAM);
+    WriteDataBlock(src, len, 0xFF);
+    ForgetContent(y_start, y_end);
+    ClockRestore(clock);
+    PROFILE_END(PROF_UPLOAD);
+
+
+}
+
 //-----------------------------------------------------------------
 // Name: LoadBitmap
 // Function: Load LCDImager compatible bitmap
 //----------------------------------------------------------------------
 void LoadBitmap(const unsigned char *bmp){
 
-    unsigned int n = 0;
+    DirtyRect changes;
+    unsigned char clock;
+
+    PROFILE_BEGIN(PROF_UPLOAD);
+    clock = ClockFast();                                // The compare runs fast too
+    // Only the part of the image that differs from what the bank already holds is sent
+    if ((bank_state & (BANK_KNOWN(RAM_BANK) | BANK_PACKED(RAM_BANK))) == BANK_KNOWN(RAM_BANK)){
+        if (FindBitmapChanges(bank_content[RAM_BANK], bmp, &changes) == 0){
+            ClockRestore(clock);
+            PROFILE_END(PROF_UPLOAD);
+            return;                                     // Nothing to do
+        }
+        LoadBitmapRect(bmp, &changes);
+#ifdef BAND_SIGNATURES
+        UpdateSignatures(bmp, 0);
+#endif
+    } else {
+#ifdef BAND_SIGNATURES
+        UpdateSignatures(bmp, 1);                       // Bank content unknown, fall back to the band signatures
+#else
+        ClearDirty(&changes);
+        MergeDirty(&changes, 0, 0, (DISPLAY_X_SIZE / 8) - 1, DISPLAY_Y_SIZE - 1);
+        LoadBitmapRect(bmp, &changes);
+#endif
+    }
 
+    bank_content[RAM_BANK] = bmp;
+    bank_state |= BANK_KNOWN(RAM_BANK);
+    bank_state &= ~BANK_PACKED(RAM_BANK);
+    ClockRestore(clock);
+    PROFILE_END(PROF_UPLOAD);
 
-    //unsigned char y = 0;
-    //unsigned char toggle = 0;
-    // So, similar to the ST7535, we need to set up the XY position, then we can write to RAM
+}
+
+//-----------------------------------------------------------------
+// Name: LoadPackedBitmap
+// Function: Load a PackBits compressed LCDImager bitmap (see Applications/PackBits)
+//           Decoded straight into the SPI stream - no RAM buffer
+//
+// Format: a run of (header, data) records until 5000 bytes are produced
+//         header 0..127   - copy the next header + 1 bytes
+//         header 129..255 - repeat the next byte 257 - header times
+//         header 128      - no operation
+// Parameters: Compressed bitmap, or BLANK_BITMAP for an all white image
+//----------------------------------------------------------------------
+void LoadPackedBitmap(const unsigned char *packed){
+
+    const unsigned char *src = packed;
+    unsigned int remaining = DISPLAY_RAM_SIZE;
+    unsigned char header;
+    unsigned char count;
+    unsigned char data;
+    unsigned char clock;
+
+    if ((bank_state & (BANK_KNOWN(RAM_BANK) | BANK_PACKED(RAM_BANK))) == (BANK_KNOWN(RAM_BANK) | BANK_PACKED(RAM_BANK))){
+        if (bank_content[RAM_BANK] == packed){
+            return;                                     // Bank already holds this image
+        }
+    }
+
+    PROFILE_BEGIN(PROF_UPLOAD);
+    clock = ClockFast();                                // Decoding is CPU bound
     MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
     SetLocation(0, 0);
     WriteCommand(WRITE_RAM);
-    // Attention, can't use a for() loop here- the MSP430 compiler tries to inline it and it doesn't work then
- //   while (n < 50){
- //       WriteData(~bmp[n]);
- //      n++;
- //   }
-    // Use this code if --opt_level=off
-    for (n = 0; n < ((DISPLAY_X_SIZE / 8) * DISPLAY_Y_SIZE); n++){
-        WriteData(~bmp[n]);
+    if (packed == BLANK_BITMAP){
+        WriteDataFill(0xFF, DISPLAY_RAM_SIZE);          // White, inverted as LoadBitmap sends it
+    } else {
+        BeginDataStream();
+        while (remaining != 0){
+            header = *src++;
+            if (header < 128){
+                count = header + 1;
+                if (count > remaining){
+                    count = remaining;
+                }
+                remaining -= count;
+                while (count != 0){
+                    StreamData(~(*src++));              // Inverted on the way, as LoadBitmap
+                    count--;
+                }
+            } else if (header > 128){
+                count = (unsigned char)(257 - header);
+                if (count > remaining){
+                    count = remaining;
+                }
+                remaining -= count;
+                data = ~(*src++);
+                while (count != 0){
+                    StreamData(data);
+                    count--;
+                }
+            }
+        }
+        EndDataStream();
+    }
+
+    ForgetContent(0, DISPLAY_Y_SIZE - 1);
+    bank_content[RAM_BANK] = packed;
+    bank_state |= BANK_KNOWN(RAM_BANK) | BANK_PACKED(RAM_BANK);
+    ClockRestore(clock);
+    PROFILE_END(PROF_UPLOAD);
+
+}
+
+//----------------------------------------------------------------------
+// Name: ForgetContent
+// Function: Note that rows y_start..y_end of the current bank were written
+//           with something other than a whole bitmap
+// Parameters: First and last row touched
+//----------------------------------------------------------------------
+static void ForgetContent(unsigned int y_start, unsigned int y_end){
+
+#ifdef BAND_SIGNATURES
+    unsigned char band;
+
+    for (band = 0; band < SIGNATURE_BANDS; band++){
+        if ((y_start < ((band + 1) * SIGNATURE_BAND_ROWS)) && (y_end >= (band * SIGNATURE_BAND_ROWS))){
+            band_valid &= ~BAND_VALID(RAM_BANK, band);
+        }
+    }
+#else
+    (void)y_start;
+    (void)y_end;
+#endif
+    bank_state &= ~(BANK_KNOWN(RAM_BANK) | BANK_PAIRED);
+
+}
+
+#ifdef BAND_SIGNATURES
+//----------------------------------------------------------------------
+// Name: BandSignature
+// Function: CRC-8 of one band of a bitmap
+// Parameters: Bitmap (or BLANK_BITMAP), band number
+// Returns: CRC-8
+//----------------------------------------------------------------------
+static unsigned char BandSignature(const unsigned char *bmp, unsigned char band){
+
+    unsigned int n;
+    unsigned char crc = 0;
+
+    for (n = 0; n < (SIGNATURE_BAND_ROWS * (DISPLAY_X_SIZE / 8)); n++){
+        if (bmp != BLANK_BITMAP){
+            crc ^= bmp[((unsigned int)band * (SIGNATURE_BAND_ROWS * (DISPLAY_X_SIZE / 8))) + n];
+        }
+        crc = (crc << 4) ^ crc8_nibble[crc >> 4];
+        crc = (crc << 4) ^ crc8_nibble[crc >> 4];
+    }
+
+    return crc;
+}
+
+//----------------------------------------------------------------------
+// Name: UpdateSignatures
+// Function: Record the band signatures of the bitmap going into the current bank
+//           and optionally send every band whose signature doesn't match
+// Parameters: Bitmap (or BLANK_BITMAP), 1 = send changed bands, 0 = record only
+//----------------------------------------------------------------------
+static void UpdateSignatures(const unsigned char *bmp, unsigned char send){
+
+    unsigned char band;
+    unsigned char sig;
+    DirtyRect rect;
+
+    for (band = 0; band < SIGNATURE_BANDS; band++){
+        sig = BandSignature(bmp, band);
+        if (send != 0){
+            if (((band_valid & BAND_VALID(RAM_BANK, band)) == 0) || (sig != band_signature[RAM_BANK][band])){
+                ClearDirty(&rect);
+                MergeDirty(&rect, 0, band * SIGNATURE_BAND_ROWS, (DISPLAY_X_SIZE / 8) - 1, ((band + 1) * SIGNATURE_BAND_ROWS) - 1);
+                LoadBitmapRect(bmp, &rect);
+            }
+        }
+        band_signature[RAM_BANK][band] = sig;
+        band_valid |= BAND_VALID(RAM_BANK, band);
+    }
+
+}
+#endif
+
+//----------------------------------------------------------------------
+// Name: LoadBitmapRect
+// Function: Send one rectangle of a bitmap to the same place in display RAM
+// Parameters: Bitmap (or BLANK_BITMAP), rectangle to send
+// Local to LoadBitmap: the caller keeps the bank's known content up to date
+//----------------------------------------------------------------------
+static void LoadBitmapRect(const unsigned char *bmp, const DirtyRect *rect){
+
+    unsigned char row;
+    unsigned char col;
+    unsigned char width;
+    const unsigned char *src;
+
+    width = (rect->x_end - rect->x_start) + 1;
+    bank_state &= ~BANK_PAIRED;
+
+    // So, similar to the ST7535, we need to set up the XY position, then we can write to RAM
+    MapRAMToDisplay(rect->x_start << 3, rect->y_start, (rect->x_end << 3) + 7, rect->y_end);
+    SetLocation(rect->x_start << 3, rect->y_start);
+    WriteCommand(WRITE_RAM);
+
+    if (bmp == BLANK_BITMAP){
+        WriteDataFill(0xFF, (unsigned int)width * ((rect->y_end - rect->y_start) + 1));
+        return;
     }
 
+    // The window goes out as one burst, inverted on the way (LCDImager uses 1 = black, the panel 0 = black)
+    BeginDataStream();
+    for (row = rect->y_start; row <= rect->y_end; row++){
+        src = bmp + ((unsigned int)row * (DISPLAY_X_SIZE / 8)) + rect->x_start;
+        for (col = 0; col < width; col++){
+            StreamData(~src[col]);
+        }
+    }
+    EndDataStream();
 
 }
 
+//----------------------------------------------------------------------
+// Name: FindBitmapChanges
+// Function: Compare two flash bitmaps and return the bounding rectangle of
+//           every byte that differs. No RAM copy of either image is needed
+// Parameters: Old and new bitmap (either may be BLANK_BITMAP), result rectangle
+// Returns: 1 if anything changed, else 0
+//----------------------------------------------------------------------
+unsigned char FindBitmapChanges(const unsigned char *old_bmp, const unsigned char *new_bmp, DirtyRect *rect){
+
+    unsigned char row;
+    unsigned char col;
+    unsigned char old_data = 0;
+    unsigned char new_data = 0;
+    unsigned int n = 0;
+
+    ClearDirty(rect);
+    if (old_bmp == new_bmp){
+        return 0;
+    }
+
+    for (row = 0; row < DISPLAY_Y_SIZE; row++){
+        for (col = 0; col < (DISPLAY_X_SIZE / 8); col++){
+            if (old_bmp != BLANK_BITMAP){
+                old_data = old_bmp[n];
+            }
+            if (new_bmp != BLANK_BITMAP){
+                new_data = new_bmp[n];
+            }
+            if (old_data != new_data){
+                if (col < rect->x_start){
+                    rect->x_start = col;
+                }
+                if (col > rect->x_end){
+                    rect->x_end = col;
+                }
+                if (row < rect->y_start){
+                    rect->y_start = row;
+                }
+                rect->y_end = row;                  // Rows are scanned in order
+            }
+            n++;
+        }
+    }
+
+    return IsDirty(rect);
+}
+
+//----------------------------------------------------------------------
+// Name: ClearDirty
+// Function: Empty a dirty rectangle
+//----------------------------------------------------------------------
+void ClearDirty(DirtyRect *rect){
+    rect->x_start = 0xFF;
+    rect->x_end = 0;
+    rect->y_start = 0xFF;
+    rect->y_end = 0;
+}
+
+//----------------------------------------------------------------------
+// Name: MergeDirty
+// Function: Grow a dirty rectangle to also cover the given area
+// Parameters: Rectangle, area in byte columns and rows (inclusive)
+//----------------------------------------------------------------------
+void MergeDirty(DirtyRect *rect, unsigned char x_start, unsigned char y_start, unsigned char x_end, unsigned char y_end){
+    if (x_start < rect->x_start){
+        rect->x_start = x_start;
+    }
+    if (x_end > rect->x_end){
+        rect->x_end = x_end;
+    }
+    if (y_start < rect->y_start){
+        rect->y_start = y_start;
+    }
+    if (y_end > rect->y_end){
+        rect->y_end = y_end;
+    }
+}
+
+//----------------------------------------------------------------------
+// Name: IsDirty
+// Function: Test a dirty rectangle
+// Returns: 1 if it covers anything, else 0
+//----------------------------------------------------------------------
+unsigned char IsDirty(const DirtyRect *rect){
+    if (rect->x_start > rect->x_end){
+        return 0;
+    }
+    return 1;
+}
+
 //----------------------------------------------------------------------
 // Name: DoDisplayTest
 // Function: Put crap in buffers to get some kind of display
@@ -232,21 +782,26 @@ void DoDisplayTest(void){
     unsigned int r;
     unsigned char y = 0;
     unsigned char toggle = 0;
+    unsigned char clock;
+
+    clock = ClockFast();
     // So, similar to the ST7535, we need to set up the XY position, then we can write to RAM
     MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
     SetLocation(0, 0);
 
     // Draw big blocks of checkeboard
     WriteCommand(WRITE_RAM);
+    BeginDataStream();
+    ForgetContent(0, DISPLAY_Y_SIZE - 1);
 
     for (r = 0; r < 200; r++){
 
         for (n = 0; n < 25; n++){
             if (toggle == 0){
-                WriteData(0x00);
+                StreamData(0x00);
                 toggle = 1;
             } else {
-                WriteData(0xFF);
+                StreamData(0xFF);
                 toggle = 0;
             }
         }
@@ -264,6 +819,8 @@ void DoDisplayTest(void){
 
     }
 
+    EndDataStream();
+    ClockRestore(clock);
 
 }
 
@@ -272,26 +829,65 @@ void DoDisplayTest(void){
 // Function: Fill buffer with data that clears the entire display
 //----------------------------------------------------------------------
 void BlankScreen(void){
-    unsigned int n;
-    // So, similar to the ST7535, we need to set up the XY position, then we can write to RAM
-    MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
-    SetLocation(0, 0);
 
+    LoadBitmap(BLANK_BITMAP);
 
-    WriteCommand(WRITE_RAM);
-    for (n = 0; n < ((DISPLAY_X_SIZE / 8) * DISPLAY_Y_SIZE); n++){
-        WriteData(0xFF);
-    }
+}
 
-    MapRAMToDisplay(0, 0, DISPLAY_X_SIZE - 1, DISPLAY_Y_SIZE - 1);
-    SetLocation(0, 0);
+//----------------------------------------------------------------------
+// Name: ShowImage
+// Function: Put a bitmap on the glass with the fewest uploads and refreshes
+//
+// The controller refreshes from the bank being written ("new") and the
+// other bank ("old", waveform selection), then swaps them. So once a
+// refresh has happened, the other bank always holds what is on the glass
+// and one diffed upload plus one refresh gives a clean transition. Only
+// the first image after reset needs the classic write/refresh/write/refresh.
+//
+// The refresh is started and not waited for (see StartDisplayFrame)
+// Parameters: Bitmap, or BLANK_BITMAP
+//----------------------------------------------------------------------
+void ShowImage(const unsigned char *bmp){
 
+    ShowContent(bmp, LoadBitmap, 0);
 
-    WriteCommand(WRITE_RAM);
-    for (n = 0; n < ((DISPLAY_X_SIZE / 8) * DISPLAY_Y_SIZE); n++){
-        WriteData(0xFF);
+}
+
+//----------------------------------------------------------------------
+// Name: ShowPackedImage
+// Function: As ShowImage, for a PackBits compressed bitmap
+// Parameters: Compressed bitmap, or BLANK_BITMAP
+//----------------------------------------------------------------------
+void ShowPackedImage(const unsigned char *packed){
+
+    ShowContent(packed, LoadPackedBitmap, 1);
+
+}
+
+//----------------------------------------------------------------------
+// Name: ShowContent
+// Function: Common part of ShowImage / ShowPackedImage
+//           The loader is passed in rather than chosen here, so a program that only shows packed images doesn't
+//           link LoadBitmap and the dirty rectangle code (and the other way round)
+// Parameters: Image, LoadBitmap or LoadPackedBitmap, 1 = PackBits compressed
+//----------------------------------------------------------------------
+static void ShowContent(const unsigned char *img, void (*load)(const unsigned char *img), unsigned char packed){
+
+    unsigned char shown = RAM_BANK ^ 1;
+
+    if (((bank_state & BANK_GLASS_SYNCED) != 0) && ((bank_state & BANK_KNOWN(shown)) != 0) && (bank_content[shown] == img)
+            && (((bank_state & BANK_PACKED(shown)) != 0) == (packed != 0))){
+        return;                                 // Already on the glass
+    }
+
+    if ((bank_state & BANK_GLASS_SYNCED) == 0){
+        load(img);
+        DisplayFrame();
     }
 
+    load(img);
+    StartDisplayFrame();
+
 }
 
 //---------------------------------------------------------------------
@@ -299,12 +895,22 @@ void BlankScreen(void){
 // Function: Specify where data will be written in DISPLAY BUFFER
 //---------------------------------------------------------------------
 void SetLocation(int x, int y){
+
+#ifdef HARDWARE_SCROLL
+    y += scroll_origin;                             // Display row -> RAM row
+    if (y >= DISPLAY_Y_SIZE){
+        y -= DISPLAY_Y_SIZE;
+    }
+#endif
+
     WriteCommand(SET_RAM_X_ADDRESS_COUNTER);
     WriteData((x >> 3) & 0xFF);
     WriteCommand(SET_RAM_Y_ADDRESS_COUNTER);        // This is so similar to the ST7565???
     WriteData(y & 0xFF);
     WriteData((y >> 8) & 0xFF);
-    PollBusy();
+    // No BUSY wait: setting the counters starts nothing on the controller, and WriteCommand has already waited out
+    // any refresh in progress
+    SHADOW_SAVED(0, 1);
 
 }
 
@@ -313,6 +919,25 @@ void SetLocation(int x, int y){
 // Function: Configure the controller to the display active area
 //--------------------------------------------------------------------
 void MapRAMToDisplay(int x_start, int y_start, int x_end, int y_end){
+
+    unsigned char full;
+
+#ifdef HARDWARE_SCROLL
+    // Once scrolled, a window may wrap past the last RAM row. Open it to the full height instead: the Y counter
+    // (SetLocation) starts in the right place and wraps, and callers write whole rows (X first), so the rows
+    // written are still the ones asked for
+    if (scroll_origin != 0){
+        y_start = 0;
+        y_end = DISPLAY_Y_SIZE - 1;
+    }
+#endif
+
+    full = (x_start == 0) && (y_start == 0) && (x_end == DISPLAY_X_SIZE - 1) && (y_end == DISPLAY_Y_SIZE - 1);
+    if (full && ((shadow_valid & SHADOW_FULL_WINDOW) != 0)){
+        SHADOW_SAVED(8, 0);
+        return;
+    }
+
     WriteCommand(SET_RAM_X_ADDRESS_START_END_POSITION);
     WriteData((x_start >> 3) & 0xFF);
     WriteData((x_end >> 3) & 0xFF);
@@ -321,45 +946,202 @@ void MapRAMToDisplay(int x_start, int y_start, int x_end, int y_end){
     WriteData((y_start >> 8) & 0xFF);
     WriteData(y_end & 0xFF);
     WriteData((y_end >> 8) & 0xFF);
+
+    if (full){
+        shadow_valid |= SHADOW_FULL_WINDOW;         // (WriteCommand has cleared it for any other window)
+    }
+}
+
+//---------------------------------------------------------------------
+// Name: SetDataEntryMode
+// Function: Set the RAM address counter direction, unless already set
+// Parameters: Mode (bit 0 = X increment, bit 1 = Y increment, bit 2 = Y first)
+//--------------------------------------------------------------------
+void SetDataEntryMode(unsigned char mode){
+
+    if (((shadow_valid & SHADOW_ENTRY_MODE) != 0) && (((shadow_valid & SHADOW_MODE_MASK) >> SHADOW_MODE_SHIFT) == mode)){
+        SHADOW_SAVED(2, 0);
+        return;
+    }
+
+    WriteCommand(DATA_ENTRY_MODE_SETTING);
+    WriteData(mode);
+
+    shadow_valid = (shadow_valid & ~SHADOW_MODE_MASK) | ((mode << SHADOW_MODE_SHIFT) & SHADOW_MODE_MASK) | SHADOW_ENTRY_MODE;
 }
 
 //---------------------------------------------------------------------
 // Name: DisplayFrame
-// Function: Transfer memory contents to glass
+// Function: Transfer memory contents to glass and wait until done
 //---------------------------------------------------------------------
 void DisplayFrame(void){
-    WriteCommand(DISPLAY_UPDATE_CONTROL_2);
-    WriteData(0xC4);
-    WriteCommand(MASTER_ACTIVATION);
-    WriteCommand(TERMINATE_FRAME_READ_WRITE);
+    StartDisplayFrame();
     PollBusy();
 }
 
+//---------------------------------------------------------------------
+// Name: StartDisplayFrame
+// Function: Transfer memory contents to glass without waiting
+//           The caller may render into frame_buffer meanwhile; the next
+//           command sent to the controller waits for the refresh to end
+//---------------------------------------------------------------------
+void StartDisplayFrame(void){
+    RunSequence(refresh_sequence);
+    bank_state ^= BANK_RAM;         // Controller now writes to the other bank
+    bank_state |= BANK_GLASS_SYNCED;    // ...which is the one that was just shown
+#ifdef DRIVER_STATS
+    frame_saved_bytes = saved_bytes;
+    frame_saved_waits = saved_waits;
+    saved_bytes = 0;
+    saved_waits = 0;
+#endif
+
+    frame_pending = 1;
+    P1IES |= BUSY_IN;               // Completion = BUSY HIGH -> LOW
+    P1IFG &= ~BUSY_IN;
+    P1IE |= BUSY_IN;
+}
+
+//---------------------------------------------------------------------
+// Name: DisplayBusy
+// Function: Query an asynchronous refresh
+// Returns: 1 = refresh still running, 0 = idle
+//---------------------------------------------------------------------
+unsigned char DisplayBusy(void){
+    return frame_pending;
+}
+
+//---------------------------------------------------------------------
+// Name: GetShadowStats
+// Function: Report what the register shadow saved while the last frame was loaded
+//           (commands and parameters not sent, BUSY waits not done). Zero unless DRIVER_STATS is defined
+// Parameters: Where to put the byte count, where to put the wait count
+//---------------------------------------------------------------------
+void GetShadowStats(unsigned int *bytes, unsigned int *waits){
+#ifdef DRIVER_STATS
+    *bytes = frame_saved_bytes;
+    *waits = frame_saved_waits;
+#else
+    *bytes = 0;
+    *waits = 0;
+#endif
+}
+
+//---------------------------------------------------------------------
+// Name: SetFrameDoneCallback
+// Function: Register a function to be called when a refresh completes
+//           Runs in interrupt context - keep it short (set a flag, toggle a pin)
+// Parameters: Callback, or 0 for none
+//---------------------------------------------------------------------
+void SetFrameDoneCallback(void (*callback)(void)){
+    frame_done_callback = callback;
+}
+
+//---------------------------------------------------------------------
+// Name: FrameComplete
+// Function: Close out a pending refresh (from the ISR or a BUSY wait)
+//---------------------------------------------------------------------
+static void FrameComplete(void){
+    unsigned short state;
+    unsigned char was_pending;
+
+    // Test and clear with interrupts off: WaitBusy may get here while the BUSY edge interrupt is still armed
+    state = __get_interrupt_state();
+    __disable_interrupt();
+    was_pending = frame_pending;
+    frame_pending = 0;
+    __set_interrupt_state(state);
+
+    if ((was_pending != 0) && (frame_done_callback != 0)){
+        frame_done_callback();
+    }
+}
+
 //-----------------------------------------------------------------------------------
 // Name: WriteLUT
 // Function: Write given data to look-up-table
 // Since the Chinese don't disclose the controller chip, not sure what this is for
 //-----------------------------------------------------------------------------------
 void WriteLUT(const unsigned char *lutdata){
-    unsigned char n;
     WriteCommand(WRITE_LUT_REGISTER);
-    for (n = 0; n < 30; n++){
-        WriteData(lutdata[n]);
+    WriteDataBlock(lutdata, 30, 0x00);
+}
+//---------------------------------------------------------------------
+// Name: PollBusy
+// Function: Wait for BUSY signal to go LOW = IDLE (sleeping, see WaitBusy)
+// Parameters: void
+// Returns: void
+//---------------------------------------------------------------------
+void PollBusy(void){
+    WaitBusy(BUSY_TIMEOUT_MS);
+}
+
+//---------------------------------------------------------------------
+// Name: WaitBusy
+// Function: Sleep in LPM3 until BUSY falls (P1.1 edge interrupt) or the
+//           timeout alarm fires, whichever comes first. Runs on the slow
+//           clock, the caller's clock is put back afterwards
+// Parameters: Timeout in milli-seconds
+// Returns: 0 = display idle, 1 = timed out with BUSY still HIGH
+//---------------------------------------------------------------------
+unsigned char WaitBusy(unsigned int timeout_ms){
+
+    unsigned char timed_out = 0;
+    unsigned char clock;
+
+    TransportDeselect();            // Fence: BUSY only means something once every queued byte has been sent
+
+    PROFILE_BEGIN(PROF_BUSY);
+    if ((P1IN & BUSY_IN) == 0){
+        FrameComplete();
+        PROFILE_END(PROF_BUSY);
+        return 0;                   // Already idle, don't bother arming anything
     }
 
+    clock = ClockSlow();
+    StartAlarm(timeout_ms);
+    P1IES |= BUSY_IN;               // Interrupt on HIGH -> LOW (busy -> idle)
+    P1IFG &= ~BUSY_IN;
+    P1IE |= BUSY_IN;
+
+    for (;;){
+        __disable_interrupt();
+        // Test with interrupts off, so an edge can't sneak in between the test and the sleep
+        if ((P1IN & BUSY_IN) == 0){
+            break;
+        }
+        if (AlarmExpired()){
+            timed_out = 1;
+            break;
+        }
+        __bis_SR_register(IDLE_LPM_BITS | GIE);     // Sleep; GIE is set in the same instruction
+    }
 
+    P1IE &= ~BUSY_IN;
+    StopAlarm();
+    FrameComplete();                // Edge taken here rather than in the ISR (or given up on)
+    __enable_interrupt();
+    ClockRestore(clock);
+    PROFILE_END(PROF_BUSY);
 
+    return timed_out;
 }
+
 //---------------------------------------------------------------------
-// Name: PollBusy
-// Function: Poll BUSY signal, and return when LOW = IDLE
+// Name: CallInBusyISR
+// Function: Call this in the PORT1 ISR
 // Parameters: void
-// Returns: void
+// Returns: 1 if the BUSY edge fired and the CPU must leave LPM3, else 0
 //---------------------------------------------------------------------
-void PollBusy(void){
-    while ((P1IN & BUSY_IN) != 0){
-        ;
+unsigned char CallInBusyISR(void){
+
+    if ((P1IFG & BUSY_IN) != 0){
+        P1IFG &= ~BUSY_IN;
+        P1IE &= ~BUSY_IN;
+        FrameComplete();
+        return 1;
     }
+    return 0;
 }
 
 //---------------------------------------------------------------------
@@ -370,8 +1152,24 @@ void PollBusy(void){
 //----------------------------------------------------------------------
 void WriteCommand(unsigned char cmd){
 
-    P1OUT &= ~D_C;                  // Data/Command pin = 0
-    SerialOut(cmd);
+    if (frame_pending != 0){
+        PollBusy();                 // Controller is still refreshing, hold off
+    }
+
+    // Commands that change the RAM window or entry mode behind the shadow's back
+    switch (cmd){
+    case SET_RAM_X_ADDRESS_START_END_POSITION:
+    case SET_RAM_Y_ADDRESS_START_END_POSITION:
+        shadow_valid &= ~SHADOW_FULL_WINDOW;
+        break;
+    case DATA_ENTRY_MODE_SETTING:
+        shadow_valid &= ~SHADOW_ENTRY_MODE;
+        break;
+    default:
+        break;
+    }
+
+    TransportQueue(cmd, TX_COMMAND);
 
 }
 
@@ -383,41 +1181,142 @@ void WriteCommand(unsigned char cmd){
 //----------------------------------------------------------------------
 void WriteData(unsigned char data){
 
-    P1OUT |= D_C;               // Data/Command pin = 1
-    SerialOut(data);
+    TransportQueue(data, TX_DATA);
 
 }
 
 //---------------------------------------------------------------------
-// Name: SerialOut
-// Function: Transfer byte on serial interface
-// Parameter: Data to be sent
+// Name: RunSequence
+// Function: Send a command sequence table (format in disp_driver.h)
+//           Each payload goes out as one data burst
+// Parameters: Sequence, ending with SEQ_END
+// Returns: void
 //----------------------------------------------------------------------
-void SerialOut(unsigned char data){
-    unsigned char dout;
-    unsigned char n;
-    P1OUT &= ~CS;           // Lower CS
-   // __delay_cycles(2);      // was 4
-    dout = data;
-    for (n = 0; n < 8; n++){
-
-        // Copy MSB of data to port PIN
-        if ((dout & 0x80) == 0x80){
-            P2OUT |= DATA;
-        } else {
-            P2OUT &= ~DATA;
+void RunSequence(const unsigned char *seq){
+
+    unsigned char control;
+    unsigned char len;
+
+    for (;;){
+        control = *seq++;
+        if ((control & SEQ_END) != 0){
+            return;
+        }
+        len = control & SEQ_LENGTH_MASK;
+
+        WriteCommand(*seq++);
+        if (len != 0){
+            WriteDataBlock(seq, len, 0x00);
+            seq += len;
+        }
+        if ((control & SEQ_DELAY) != 0){
+            TransportDeselect();                    // Delay sleeps in LPM3, where SMCLK (and USCI_B0) stop
+            Delay(*seq++);
         }
-        dout = dout << 1;
-        // Clock the bit
-        P2OUT |= CLK;
-       // __delay_cycles(2);   // was 10
-        P2OUT &= ~CLK;
-       // __delay_cycles(2);
+        if ((control & SEQ_WAIT_BUSY) != 0){
+            PollBusy();
+        }
+    }
+
+}
+
+//---------------------------------------------------------------------
+// Name: BeginDataStream
+// Function: Open a burst of data bytes - D/C is set HIGH and CS held LOW
+//           until EndDataStream(), so only the payload bytes are clocked
+// Parameters: void
+// Returns: void
+//----------------------------------------------------------------------
+void BeginDataStream(void){
+
+    TransportSetDC(TX_DATA);    // Data/Command pin = 1 once queued bytes are out
+    TransportSelect();          // Lower CS for the whole burst
+
+}
+
+//---------------------------------------------------------------------
+// Name: StreamData
+// Function: Send one byte of an open data stream
+// Parameters: Data to be written
+// Returns: void
+//----------------------------------------------------------------------
+void StreamData(unsigned char data){
+
+    TransportWrite(data);
+
+}
+
+//---------------------------------------------------------------------
+// Name: StreamDataBlock
+// Function: Send a block of an open data stream, each byte XORed with a mask
+//           With the USCI transport this returns as soon as the previous block is done and the block goes out from
+//           the TX interrupt: leave the source alone until the next StreamDataBlock() or EndDataStream()
+// Parameters: Source data, byte count, XOR mask
+// Returns: void
+//----------------------------------------------------------------------
+void StreamDataBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask){
+
+    TransportWriteBlock(src, len, xor_mask);
+
+}
+
+//---------------------------------------------------------------------
+// Name: EndDataStream
+// Function: Close a burst opened by BeginDataStream
+// Parameters: void
+// Returns: void
+//----------------------------------------------------------------------
+void EndDataStream(void){
+
+    TransportDeselect();
+
+}
+
+//---------------------------------------------------------------------
+// Name: WriteDataBlock
+// Function: Write a block of data as one burst (D/C and CS set once)
+// Parameters: Source data, byte count, XOR mask applied to every byte
+//             (0x00 = as is, 0xFF = inverted)
+// Returns: void
+//----------------------------------------------------------------------
+void WriteDataBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask){
+
+    BeginDataStream();
+    while (len != 0){
+        TransportWrite(*src ^ xor_mask);
+        src++;
+        len--;
     }
+    EndDataStream();
 
-    P1OUT |= CS;
+}
 
+//---------------------------------------------------------------------
+// Name: WriteDataFill
+// Function: Write the same data byte len times as one burst
+// Parameters: Data to be written, byte count
+// Returns: void
+//----------------------------------------------------------------------
+void WriteDataFill(unsigned char data, unsigned int len){
+
+    BeginDataStream();
+    while (len != 0){
+        TransportWrite(data);
+        len--;
+    }
+    EndDataStream();
 
 }
 
+//---------------------------------------------------------------------
+// Name: SerialOut
+// Function: Transfer byte on serial interface, framed by CS
+// Parameter: Data to be sent
+//----------------------------------------------------------------------
+void SerialOut(unsigned char data){
+
+    TransportSelect();          // Lower CS
+    TransportWrite(data);
+    TransportDeselect();        // Raise CS once the byte is out
 
+}
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: displist.c
+//                  Display list renderer for the e-ink panel
+//                          Author: Sonikku
+//
+//              A screen is described by a const DisplayCommand list in flash and drawn one half band at a time: the
+//              half is cleared, every command that reaches it is drawn into it (clipped), and it is sent while the
+//              other half is drawn. The whole 200 x 200 screen is drawn through the 400 byte frame_buffer, so
+//              nothing but the list itself has to be kept for the screen to be redrawn.
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "displist.h"
+#include "disp_driver.h"
+#include "graphlib.h"
+#include "profile.h"
+#include "clock.h"
+
+#define HALF_BAND_ROWS (BAND_ROWS / 2)      // frame_buffer is drawn and sent in two halves
+
+
+//---------------------------------------------------------------------------------------------------------------
+// Name: DrawCommand
+// Function: Draw one display list command into the current band
+// Parameters: Command, drawing row held in frame_buffer row 0
+// Returns: void
+//---------------------------------------------------------------------------------------------------------------
+static void DrawCommand(const DisplayCommand *item, int origin){
+
+    switch (item->cmd){
+    case DL_TEXT:
+        SetBandOrigin(origin - item->y);        // Text rows are counted from the top of the string
+        DISPLAY_ROW = 0;
+        DISPLAY_COLUMN = item->x;
+        BlitString((const char *)item->data, item->font);
+        SetBandOrigin(origin);
+        break;
+    case DL_BITMAP:
+        BandBitmap((const unsigned char *)item->data, item->x, item->y, item->w, item->h);
+        break;
+    case DL_BAR:
+        BandBar(item->x, item->y, item->w, item->h);
+        break;
+    case DL_BOX:
+        BandBox(item->x, item->y, item->w, item->h);
+        break;
+    case DL_LINE:
+        BandLine(item->x, item->y, item->w, item->h);
+        break;
+    default:
+        break;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------
+// Name: CommandTop / CommandBottom
+// Function: First and last drawing row touched by a command, used to skip commands outside a band
+// Parameters: Command
+// Returns: Row
+//---------------------------------------------------------------------------------------------------------------
+static int CommandTop(const DisplayCommand *item){
+
+    if ((item->cmd == DL_LINE) && (item->h < item->y)){
+        return item->h;
+    }
+    return item->y;
+}
+
+static int CommandBottom(const DisplayCommand *item){
+
+    if (item->cmd == DL_LINE){
+        return (item->h > item->y) ? item->h : item->y;
+    }
+    return item->y + item->h - 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------
+// Name: RenderDisplayList
+// Function: Draw a display list over the whole screen and load it into the display RAM
+//           frame_buffer is used as two half bands: while one half is being sent (from the USCI TX interrupt) the
+//           next is drawn into the other, so drawing and sending overlap. The screen goes out as one data stream
+//           Call DisplayFrame() (or StartDisplayFrame()) afterwards to show it
+// Parameters: Display list (ends with DL_END)
+// Returns: void
+//---------------------------------------------------------------------------------------------------------------
+void RenderDisplayList(const DisplayCommand *list){
+    int band_y;
+    int origin;
+    unsigned char first;
+    unsigned char rows;
+    const DisplayCommand *item;
+    unsigned char clock;
+
+    PROFILE_BEGIN(PROF_UPLOAD);
+    clock = ClockFast();
+    InitFrameBuffer();
+    BeginScreenStream();
+
+    first = 0;
+    for (band_y = 0; band_y < DISPLAY_Y_SIZE; band_y += HALF_BAND_ROWS){
+        rows = HALF_BAND_ROWS;
+        if ((band_y + HALF_BAND_ROWS) > DISPLAY_Y_SIZE){
+            rows = DISPLAY_Y_SIZE - band_y;
+        }
+
+        // The other half may still be going out, this one finished before it was started
+        origin = band_y - first;
+        SetBandClip(first, first + rows - 1);
+        SetBandOrigin(origin);
+        ClearBand();
+        for (item = list; item->cmd != DL_END; item++){
+            if ((CommandBottom(item) >= band_y) && (CommandTop(item) < (band_y + rows))){
+                DrawCommand(item, origin);
+            }
+        }
+        StreamDataBlock(&frame_buffer[first * (DISPLAY_X_SIZE / 8)], (unsigned int)rows * (DISPLAY_X_SIZE / 8), 0xFF);
+
+        first = first ^ HALF_BAND_ROWS;         // Swap halves
+    }
+
+    EndDataStream();                            // Waits for the last half
+    InitFrameBuffer();
+    ClockRestore(clock);
+    PROFILE_END(PROF_UPLOAD);
+
+}
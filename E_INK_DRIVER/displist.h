@@ -0,0 +1,32 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for displist.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef DISPLIST_H_
+#define DISPLIST_H_
+
+// Display list commands
+//----------------------
+#define DL_END      0                   // End of list
+#define DL_TEXT     1                   // String at x,y: h = text height (pixels), data = string, font = font index table
+#define DL_BITMAP   2                   // Bitmap at x,y: w (multiple of 8) x h pixels, data = bitmap (LCDImager layout)
+#define DL_BAR      3                   // Filled rectangle at x,y of w x h pixels
+#define DL_BOX      4                   // Rectangle outline at x,y of w x h pixels
+#define DL_LINE     5                   // Line from x,y to w,h
+
+// A display list is a const array of these, ending with DL_END, so it lives in flash
+typedef struct {
+    unsigned char cmd;
+    unsigned char x;
+    unsigned char y;
+    unsigned char w;
+    unsigned char h;
+    const void *data;
+    const int *font;
+} DisplayCommand;
+
+// Function Prototypes
+//----------------------
+void RenderDisplayList(const DisplayCommand *list);
+
+#endif /* DISPLIST_H_ */
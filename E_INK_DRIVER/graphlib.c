@@ -12,11 +12,16 @@
 
 #include <msp430.h>
 #include "graphlib.h"
+#include "profile.h"
+#include "clock.h"
 #include <stdbool.h>
 
 unsigned char inverse_mode;
 unsigned char masking;
 unsigned char BsShift;
+int band_origin;                        // Drawing row held in frame_buffer row 0 (horizontal band)
+unsigned char band_first;               // frame_buffer rows that may be drawn into (horizontal band)
+unsigned char band_last;
 
 
 
@@ -39,6 +44,9 @@ void InitFrameBuffer(void){
 
         DISPLAY_ROW = 0;
         DISPLAY_COLUMN = 0;
+        band_origin = 0;
+        band_first = 0;
+        band_last = BAND_ROWS - 1;
 #ifdef SMALL_BUFFER
     for (n = 0; n < (DISPLAY_X_SIZE / 8) * 16; n++){
         frame_buffer[n] = 0;
@@ -181,6 +189,9 @@ void OutChar(unsigned char ascii_char, const int *fonttype){
 //----------------------------------------------------------------------------------------------
 void OutString(const char *string, const int *fontname){
           unsigned int textptr = 0;
+          unsigned char clock;
+          PROFILE_BEGIN(PROF_TEXT);
+          clock = ClockFast();
           for (;;){
                     if ((string[textptr]) != 0){
                     OutChar(string[textptr], fontname);
@@ -189,4 +200,384 @@ void OutString(const char *string, const int *fontname){
                         break;
                     }
           }
+          ClockRestore(clock);
+          PROFILE_END(PROF_TEXT);
 }
+
+
+
+// Horizontal band rendering
+// frame_buffer is used as BAND_ROWS rows of 25 bytes in panel order (MSB = leftmost pixel), so LoadBand() can send it
+// as it is. DISPLAY_COLUMN is the pixel x of the next character, DISPLAY_ROW the text row (8 pixels) it starts on
+// band_origin is the drawing row that lands in frame_buffer row 0, so a tall screen can be drawn one band at a time:
+// anything outside the band is clipped. Drawing can be limited to some of the band rows (SetBandClip), so one half of
+// frame_buffer can be drawn while the other half is still being sent
+//---------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------
+// Name: SetBandOrigin
+// Function: Set which drawing row is held in the first row of the band
+// Parameters: Drawing row (may be negative)
+// Returns: void
+//----------------------------------------------------------------
+void SetBandOrigin(int y){
+
+    band_origin = y;
+}
+
+//----------------------------------------------------------------
+// Name: SetBandClip
+// Function: Limit band drawing to frame_buffer rows first..last
+// Parameters: First row, last row (0 .. BAND_ROWS - 1)
+// Returns: void
+//----------------------------------------------------------------
+void SetBandClip(unsigned char first, unsigned char last){
+
+    band_first = first;
+    band_last = last;
+}
+
+//----------------------------------------------------------------
+// Name: ClearBand
+// Function: Clear the band rows set by SetBandClip, leaving the rest of frame_buffer alone
+// Parameters: void
+// Returns: void
+//----------------------------------------------------------------
+void ClearBand(void){
+    unsigned int n;
+    unsigned int end;
+
+    end = ((unsigned int)band_last + 1) * (DISPLAY_X_SIZE / 8);
+    for (n = (unsigned int)band_first * (DISPLAY_X_SIZE / 8); n < end; n++){
+        frame_buffer[n] = 0;
+    }
+}
+
+//----------------------------------------------------------------
+// Name: BlitByte
+// Function: OR 8 horizontal pixels into the band at any pixel x
+// Parameters: Pixel x, pixel row, pixel data (MSB = leftmost)
+// Returns: void
+//----------------------------------------------------------------
+static void BlitByte(unsigned int x, int y, unsigned char data){
+    unsigned int location;
+    unsigned char shift;
+
+    y = y - band_origin;
+    if ((data == 0) || (y < band_first) || (y > band_last) || (x >= DISPLAY_X_SIZE)){
+        return;
+    }
+
+    location = (y * (DISPLAY_X_SIZE / 8)) + (x >> 3);
+    shift = x & 7;
+    frame_buffer[location] |= data >> shift;
+    if ((shift != 0) && ((x >> 3) < ((DISPLAY_X_SIZE / 8) - 1))){
+        frame_buffer[location + 1] |= data << (8 - shift);
+    }
+}
+
+//----------------------------------------------------------------
+// Name: BandSpan
+// Function: Set a run of pixels on one row of the band
+// Parameters: First pixel x, last pixel x, drawing row
+// Returns: void
+//----------------------------------------------------------------
+static void BandSpan(unsigned int x_start, unsigned int x_end, int y){
+    unsigned char *p;
+    unsigned char first;
+    unsigned char last;
+    unsigned char n;
+
+    y = y - band_origin;
+    if ((y < band_first) || (y > band_last) || (x_start >= DISPLAY_X_SIZE) || (x_start > x_end)){
+        return;
+    }
+    if (x_end >= DISPLAY_X_SIZE){
+        x_end = DISPLAY_X_SIZE - 1;
+    }
+
+    p = &frame_buffer[(y * (DISPLAY_X_SIZE / 8)) + (x_start >> 3)];
+    first = 0xFF >> (x_start & 7);
+    last = 0xFF << (7 - (x_end & 7));
+    if ((x_start >> 3) == (x_end >> 3)){
+        *p |= first & last;
+        return;
+    }
+    *p++ |= first;
+    for (n = (x_start >> 3) + 1; n < (x_end >> 3); n++){
+        *p++ = 0xFF;
+    }
+    *p |= last;
+}
+
+//----------------------------------------------------------------
+// Name: BandPixel
+// Function: Set a single pixel in the band
+// Parameters: Pixel x, drawing row
+// Returns: void
+//----------------------------------------------------------------
+void BandPixel(unsigned int x, int y){
+
+    y = y - band_origin;
+    if ((y < band_first) || (y > band_last) || (x >= DISPLAY_X_SIZE)){
+        return;
+    }
+    frame_buffer[(y * (DISPLAY_X_SIZE / 8)) + (x >> 3)] |= 0x80 >> (x & 7);
+}
+
+//----------------------------------------------------------------
+// Name: BandBar
+// Function: Draw a filled rectangle into the band
+// Parameters: Left x, top row, width, height (pixels)
+// Returns: void
+//----------------------------------------------------------------
+void BandBar(unsigned int x, int y, unsigned int width, unsigned int height){
+    int row;
+    int last;
+
+    if ((width == 0) || (height == 0)){
+        return;
+    }
+    row = y;
+    last = y + height - 1;
+    if (row < band_origin + band_first){        // Only visit the rows held in the band
+        row = band_origin + band_first;
+    }
+    if (last > band_origin + band_last){
+        last = band_origin + band_last;
+    }
+    for (; row <= last; row++){
+        BandSpan(x, x + width - 1, row);
+    }
+}
+
+//----------------------------------------------------------------
+// Name: BandBox
+// Function: Draw a one pixel rectangle outline into the band
+// Parameters: Left x, top row, width, height (pixels)
+// Returns: void
+//----------------------------------------------------------------
+void BandBox(unsigned int x, int y, unsigned int width, unsigned int height){
+
+    if ((width == 0) || (height == 0)){
+        return;
+    }
+    BandBar(x, y, width, 1);
+    BandBar(x, y + height - 1, width, 1);
+    BandBar(x, y, 1, height);
+    BandBar(x + width - 1, y, 1, height);
+}
+
+//----------------------------------------------------------------
+// Name: BandLine
+// Function: Draw a line between two points into the band (Bresenham)
+// Parameters: Start x, start row, end x, end row
+// Returns: void
+//----------------------------------------------------------------
+void BandLine(int x0, int y0, int x1, int y1){
+    int dx;
+    int dy;
+    int sx;
+    int sy;
+    int err;
+    int e2;
+
+    dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);     // Negative
+    sx = (x0 < x1) ? 1 : -1;
+    sy = (y0 < y1) ? 1 : -1;
+    err = dx + dy;
+
+    for (;;){
+        BandPixel(x0, y0);
+        if ((x0 == x1) && (y0 == y1)){
+            break;
+        }
+        e2 = 2 * err;
+        if (e2 >= dy){
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx){
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+//----------------------------------------------------------------
+// Name: BandBitmap
+// Function: OR a bitmap (LCDImager layout, 1 = black, MSB = left) into the band
+// Parameters: Bitmap, left x, top row, width (multiple of 8), height (pixels)
+// Returns: void
+//----------------------------------------------------------------
+void BandBitmap(const unsigned char *bmp, unsigned int x, int y, unsigned int width, unsigned int height){
+    int row;
+    int last;
+    unsigned int col;
+    const unsigned char *src;
+
+    row = y;
+    last = y + height - 1;
+    if (row < band_origin + band_first){
+        row = band_origin + band_first;
+    }
+    if (last > band_origin + band_last){
+        last = band_origin + band_last;
+    }
+    for (; row <= last; row++){
+        src = &bmp[(row - y) * (width / 8)];
+        for (col = 0; col < width; col += 8){
+            BlitByte(x + col, row, *src++);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Name: BlitChar
+// Function: As OutChar, but draws straight into a horizontal band at pixel x = DISPLAY_COLUMN (no LoadText conversion)
+//           Glyph columns are taken 8 at a time and turned with FlipBlock, then ORed in. Baseline shift and inverse
+//           mode behave as in OutChar
+// Parameters: character (ASCII), Font Type (int)
+// Effects: DISPLAY_COLUMN is updated
+// Returns: void
+//-----------------------------------------------------------------------------------------------------------------------
+void BlitChar(unsigned char ascii_char, const int *fonttype){
+    unsigned char *px;                      /* Declare pointer variable */
+    unsigned int font_ptr;                  /* Font array address storage */
+    unsigned char run_length;
+    unsigned char char_height;
+    unsigned char cell;
+    unsigned char col;
+    unsigned char n;
+    unsigned char line;
+    unsigned char glyph;
+    unsigned char block[8];
+    int top;
+
+    px = 0;                                 /* Reset pointer at runtime */
+    font_ptr = fonttype[ascii_char];
+    px = (px + (font_ptr));                 /* Set pointer to point to font data */
+
+    /* Process character's header information */
+    run_length = (*px & 0x1F);
+    char_height = ((*px >> 6) & 0x03) + 1;
+    px++;
+
+    for (cell = 0; cell < char_height; cell++){
+        top = ((DISPLAY_ROW + cell) * 8) - band_origin;
+        if ((top + 7 < band_first) || (top > band_last)){
+            px += run_length;                   // Cell is outside the band, nothing to draw
+            continue;
+        }
+        // run_length glyph columns plus the inter-character whitespace column
+        for (col = 0; col <= run_length; col += 8){
+            for (n = 0; n < 8; n++){
+                if ((col + n) < run_length){
+                    glyph = px[col + n];
+                    if(BsShift > 0){
+                        glyph = glyph >> BsShift;
+                    }
+                    if(inverse_mode == true){
+                        glyph = ~glyph & masking;
+                    }
+                } else if (((col + n) == run_length) && (inverse_mode == true)){
+                    glyph = 0xFF & masking;
+                } else {
+                    glyph = 0x00;
+                }
+                block[n] = glyph;
+            }
+            FlipBlock(block);
+            for (line = 0; line < 8; line++){
+                BlitByte(DISPLAY_COLUMN + col, ((DISPLAY_ROW + cell) * 8) + line, block[7 - line]);
+            }
+        }
+        px += run_length;
+    }
+
+    DISPLAY_COLUMN = DISPLAY_COLUMN + run_length + 1;
+}
+
+//----------------------------------------------------------------------------------------------
+// Name: BlitString
+// Function: Output string into the horizontal band
+// Parameters: String, Pointer to Font Index Table
+// Returns: void
+//----------------------------------------------------------------------------------------------
+void BlitString(const char *string, const int *fontname){
+    unsigned int textptr = 0;
+    unsigned char clock;
+
+    PROFILE_BEGIN(PROF_TEXT);
+    clock = ClockFast();
+    while (string[textptr] != 0){
+        BlitChar(string[textptr], fontname);
+        textptr++;
+    }
+    ClockRestore(clock);
+    PROFILE_END(PROF_TEXT);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Name: FlipBlock
+// Function: Flip an 8 x 8 bit matrix about its anti-diagonal, in place: out[i] bit j = in[7 - j] bit (7 - i)
+//           Turns 8 vertical glyph bytes (bit 0 = top) into 8 horizontal panel bytes (MSB = left), bottom line first
+//           Squares of 1, 2 and then 4 bits are swapped across the diagonal with a mask each: first between the
+//           lines of each pair, then with the lines paired into 16 bit words. No branches and no per bit work
+// Parameters: 8 byte block
+// Returns: void
+//----------------------------------------------------------------------------------------------------------------------
+void FlipBlock(unsigned char *block){
+
+    unsigned int a;                             // Lines 0 and 1 (line 0 in the high byte) once paired
+    unsigned int b;                             // Lines 2 and 3
+    unsigned int c;                             // Lines 4 and 5
+    unsigned int d;                             // Lines 6 and 7
+    unsigned int t;
+
+    // 1 bit squares between the two lines of each pair
+    a = block[0];
+    b = block[1];
+    t = (b ^ (a << 1)) & 0xAA;
+    a = ((a ^ (t >> 1)) << 8) | (b ^ t);
+    c = block[2];
+    b = block[3];
+    t = (b ^ (c << 1)) & 0xAA;
+    b = ((c ^ (t >> 1)) << 8) | (b ^ t);
+    c = block[4];
+    d = block[5];
+    t = (d ^ (c << 1)) & 0xAA;
+    c = ((c ^ (t >> 1)) << 8) | (d ^ t);
+    d = block[6];
+    t = block[7];
+    t = (t ^ (d << 1)) & 0xAA;
+    d = ((d ^ (t >> 1)) << 8) | (block[7] ^ t);
+
+    // 2 bit squares between pairs
+    t = (b ^ (a << 2)) & 0xCCCC;
+    b = b ^ t;
+    a = a ^ (t >> 2);
+    t = (d ^ (c << 2)) & 0xCCCC;
+    d = d ^ t;
+    c = c ^ (t >> 2);
+
+    // 4 bit squares between the top and bottom halves
+    t = (a & 0xF0F0) | ((c >> 4) & 0x0F0F);
+    c = ((a << 4) & 0xF0F0) | (c & 0x0F0F);
+    a = t;
+    t = (b & 0xF0F0) | ((d >> 4) & 0x0F0F);
+    d = ((b << 4) & 0xF0F0) | (d & 0x0F0F);
+    b = t;
+
+    block[0] = a >> 8;
+    block[1] = a & 0xFF;
+    block[2] = b >> 8;
+    block[3] = b & 0xFF;
+    block[4] = c >> 8;
+    block[5] = c & 0xFF;
+    block[6] = d >> 8;
+    block[7] = d & 0xFF;
+
+}
+
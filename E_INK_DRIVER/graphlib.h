@@ -20,6 +20,13 @@ unsigned char DISPLAY_COLUMN;    // DISPLAY_ROW (x-direction in framebuffer)
 unsigned char DISPLAY_ROW;       // DISPLAY_COLUMN (y-direction in framebuffer)
 
 
+#ifdef SMALL_BUFFER
+#define BAND_ROWS 16                    // Pixel rows held by frame_buffer when used as a horizontal band (BlitChar)
+#else
+#define BAND_ROWS DISPLAY_Y_SIZE
+#endif
+
+
 #ifdef HORIZONTAL_DISPLAY_PIXEL_ORG
 #ifdef SMALL_BUFFER
 unsigned char frame_buffer[(DISPLAY_X_SIZE / 8) * 16];                    // Frame buffer small
@@ -46,5 +53,16 @@ void ShiftBsline(unsigned char shift);
 void SetInverse(unsigned char set, unsigned char mask);
 void OutChar(unsigned char ascii_char, const int *fonttype);
 void OutString(const char *string, const int *fontname);
+void FlipBlock(unsigned char *block);
+void BlitChar(unsigned char ascii_char, const int *fonttype);
+void BlitString(const char *string, const int *fontname);
+void SetBandOrigin(int y);
+void SetBandClip(unsigned char first, unsigned char last);
+void ClearBand(void);
+void BandPixel(unsigned int x, int y);
+void BandBar(unsigned int x, int y, unsigned int width, unsigned int height);
+void BandBox(unsigned int x, int y, unsigned int width, unsigned int height);
+void BandLine(int x0, int y0, int x1, int y1);
+void BandBitmap(const unsigned char *bmp, unsigned int x, int y, unsigned int width, unsigned int height);
 
 #endif /* GRAPHLIB_H_ */
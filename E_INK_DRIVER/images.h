@@ -0,0 +1,524 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Demo images for main.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef IMAGES_H_
+#define IMAGES_H_
+
+// PackBits compressed (Applications/PackBits), shown with ShowPackedImage(). Raw images are in Source Images/,
+// and EinkSim checks that these unpack to them
+static const unsigned char Sonic []={
+            0x01,0x00,0x07,0xED,0x00,0x04,0x0F,0x0E,0x00,0x00,0x0F,0xED,0x00,0x10,0x1F,0x1A,
+            0x00,0x22,0x1F,0x02,0x49,0x24,0x92,0x49,0x24,0x44,0x44,0x92,0x49,0x24,0x40,0xF9,
+            0x00,0x05,0x1E,0x14,0x00,0x00,0x3F,0x98,0xEE,0x00,0x05,0x3E,0x3C,0x00,0x00,0x7F,
+            0x98,0xEE,0x00,0x05,0x3C,0x68,0x00,0x12,0x7B,0xF8,0xFD,0x00,0x06,0x02,0x22,0x22,
+            0x00,0x00,0x02,0x20,0xF9,0x00,0x0F,0x78,0x58,0x00,0x00,0xF3,0xFC,0x49,0x24,0x92,
+            0x49,0x20,0x00,0x00,0x24,0x92,0x48,0xF8,0x00,0x05,0x78,0xF0,0x00,0x01,0xE1,0xFC,
+            0xEE,0x00,0x05,0xF0,0xA0,0x00,0x23,0xE1,0xFC,0xFD,0x00,0x02,0x02,0x22,0x22,0xFE,
+            0x00,0x00,0x90,0xFA,0x00,0x07,0x01,0xF1,0xE0,0x00,0x07,0xC3,0xCE,0x10,0xFE,0x00,
+            0x05,0x10,0x00,0x00,0x20,0x00,0x10,0xF9,0x00,0x0A,0x01,0xE1,0x40,0x00,0x0F,0x87,
+            0xEE,0x01,0x24,0x92,0x49,0xFE,0x00,0x01,0x02,0x49,0xF8,0x00,0x07,0x03,0xE3,0xC0,
+            0x00,0x1F,0x0F,0xEE,0x04,0xFE,0x00,0x06,0x01,0x11,0x11,0x00,0x00,0x04,0x88,0xFA,
+            0x00,0x06,0x03,0xC2,0x80,0x00,0x3E,0x1E,0xF7,0xFD,0x00,0x05,0x20,0x00,0x00,0x10,
+            0x00,0x20,0xF9,0x00,0x07,0x07,0xC7,0x80,0x00,0x3C,0x3E,0x77,0x10,0xFE,0x00,0x00,
+            0x80,0xFD,0x00,0x00,0x80,0xF9,0x00,0x0F,0x07,0x8D,0x00,0x00,0x78,0x3C,0x77,0x00,
+            0x92,0x49,0x24,0x04,0x44,0x44,0x42,0x48,0xF8,0x00,0x07,0x0F,0x0B,0x00,0x00,0xF0,
+            0x78,0x7B,0x82,0xF8,0x00,0x04,0x56,0xDF,0xFF,0xFD,0x50,0xFE,0x00,0x07,0x0F,0x1E,
+            0x00,0x00,0xE0,0xF0,0x3B,0x80,0xFE,0x00,0x31,0x20,0x00,0x00,0x08,0x00,0x0B,0x6D,
+            0xEA,0xDB,0x6F,0xFE,0x80,0x00,0x00,0x1E,0x14,0x00,0x00,0xE1,0xE0,0x3B,0x88,0x00,
+            0x00,0x02,0x02,0x22,0x22,0x20,0x81,0x7D,0xB6,0xBF,0x6D,0xB5,0x57,0xF4,0x00,0x00,
+            0x1E,0x1C,0x00,0x00,0xC3,0xC0,0xBD,0xC0,0x92,0x49,0x20,0xFD,0x00,0x11,0x17,0xAA,
+            0xDB,0xD5,0xB6,0xDF,0xFA,0xBF,0x40,0x00,0x1C,0x08,0x00,0x00,0x87,0x82,0x1D,0xC0,
+            0xFE,0x00,0x0C,0x40,0x00,0x00,0x01,0x7A,0xDF,0x6D,0x6E,0xDB,0xEA,0xAF,0xD5,0xF0,
+            0xFC,0x00,0x13,0x0F,0x88,0x1D,0xC0,0x00,0x00,0x04,0x08,0x88,0x88,0x8B,0xAD,0x6A,
+            0xB7,0xB5,0xBD,0x7F,0x75,0x7E,0xBE,0xFC,0x00,0x06,0x1E,0x00,0x1E,0xE2,0x00,0x00,
+            0x10,0xFE,0x00,0x0A,0x3D,0x77,0xB7,0xDA,0xDE,0xEF,0xAA,0xDE,0xD5,0xD7,0xC0,0xFD,
+            0x00,0x14,0x1E,0x00,0x8E,0xE0,0x49,0x24,0x80,0x80,0x00,0x01,0xD6,0xAA,0xDA,0xB7,
+            0x6B,0x55,0x7D,0xAB,0x7E,0xFA,0xF8,0xFD,0x00,0x03,0x3C,0x10,0x0E,0xE0,0xFE,0x00,
+            0x0D,0x08,0x88,0x8E,0xB5,0xFF,0x6F,0x6D,0xBD,0xFF,0xAB,0xFD,0xAB,0x57,0x5E,0xFD,
+            0x00,0x15,0xF8,0x02,0x0F,0x70,0x00,0x00,0x04,0x20,0x00,0x35,0xDE,0xAA,0xDA,0xDB,
+            0x6B,0x56,0xFD,0x56,0xF6,0xFB,0xEB,0x80,0xFE,0x00,0x15,0xFF,0x00,0x07,0x70,0x04,
+            0x20,0x40,0x00,0x20,0xDA,0xAB,0x6D,0xB7,0x76,0xDF,0xFF,0xEF,0xED,0xAD,0xAD,0x7E,
+            0xE0,0xFE,0x00,0x15,0xFF,0xF8,0x07,0xBF,0x40,0x04,0x00,0x02,0x03,0x6F,0x75,0xB6,
+            0xDB,0xAD,0xB6,0xDB,0x75,0x5B,0x7B,0xF7,0xAB,0xB0,0xFE,0x00,0x15,0xFF,0xFF,0xD7,
+            0xDB,0xFA,0x00,0x08,0x88,0x0D,0xB5,0xAE,0xDB,0x6D,0x76,0xFF,0x77,0xFE,0xEE,0xDD,
+            0x5A,0xFD,0xFC,0xFE,0x00,0x15,0xFF,0xFF,0xFA,0xED,0x5F,0x40,0x80,0x00,0x36,0xDA,
+            0xF7,0x6D,0xB7,0xAF,0xD5,0xDD,0x75,0xBB,0x6F,0xEF,0x56,0xAF,0xFE,0x00,0xFE,0xFF,
+            0x45,0x77,0xEB,0xE0,0x00,0x00,0xDB,0x6F,0x5A,0xDB,0xDA,0xFB,0x7E,0xB7,0xDE,0xD7,
+            0xB5,0x75,0xFB,0xFB,0x80,0x00,0x00,0x2F,0xFF,0xFD,0xAD,0x7D,0x7C,0x08,0x83,0x6D,
+            0xB5,0xEF,0x6D,0x6F,0x5D,0xAB,0xDA,0xFB,0x7A,0xDF,0xBE,0xAE,0xAE,0xC0,0x00,0x00,
+            0x01,0x7F,0xFE,0xF6,0xAF,0xBF,0x00,0x0D,0xB6,0xDA,0xB5,0xB7,0xB5,0xF6,0xFD,0x7F,
+            0x6D,0xDF,0x75,0x6B,0xF7,0xF7,0xF0,0xFE,0x00,0x15,0x0B,0xFB,0x5B,0xD5,0xD7,0xC0,
+            0x2A,0xDB,0x6F,0xDE,0xDD,0x6F,0x5B,0x57,0xEB,0xBE,0xEB,0xDF,0xDE,0xBA,0xBA,0xB8,
+            0xFD,0x00,0x46,0x3D,0xED,0x7E,0xFD,0xF0,0x7F,0x6D,0xB5,0x6B,0x6B,0xBB,0xED,0xFD,
+            0x7D,0xFB,0x5D,0x6A,0xF7,0xDF,0xDF,0xEC,0x00,0x00,0x20,0x00,0x07,0x56,0xAB,0x57,
+            0x7D,0xAA,0xB6,0xDE,0xDD,0xBD,0xDD,0x77,0x55,0x1E,0xAD,0xF7,0xBF,0x5A,0xEA,0xEA,
+            0xBE,0x00,0x00,0x02,0x00,0x0D,0xBB,0xDD,0xFD,0xDE,0xDB,0xDB,0x6B,0x6E,0xD6,0xEF,
+            0xAD,0xE8,0xAB,0xFE,0xBA,0xEB,0xEF,0x7F,0x7F,0xEB,0xFE,0x00,0x2F,0x48,0x06,0xD5,
+            0x6B,0x57,0x7B,0x6D,0x6D,0xBD,0xB5,0xFB,0x75,0x7E,0x92,0x1D,0x5B,0xDF,0x7D,0x7B,
+            0xAB,0xAA,0xBF,0x80,0x00,0x10,0x00,0x8F,0x6E,0xBD,0xFD,0xED,0xB6,0xB6,0xD6,0xDE,
+            0xAD,0xBF,0xB5,0x48,0x8F,0xFD,0x6B,0xAF,0xAD,0xFD,0xFF,0xEB,0xC0,0xFE,0x00,0x47,
+            0x0A,0xB5,0xD6,0xAF,0x56,0xDB,0xDB,0x7B,0x6B,0xDB,0xD5,0xF4,0x22,0x0D,0x5F,0xBD,
+            0xF5,0xF6,0xAE,0xAA,0xBE,0xC0,0x00,0x02,0x04,0x0F,0xDB,0x6D,0xF5,0xFB,0x6D,0x6D,
+            0xAD,0xBD,0x6E,0xBB,0x4A,0x88,0x4F,0xFA,0xEE,0xBE,0xBF,0xF7,0xFF,0xEB,0xE0,0x00,
+            0x20,0x40,0x4A,0xAD,0xB7,0x5F,0x55,0xB7,0xB6,0xF6,0xEF,0xBB,0xDF,0xA0,0x21,0x0D,
+            0x5F,0x77,0xD7,0xD5,0x5D,0x55,0x7E,0xB0,0xFE,0x00,0x47,0x0F,0x76,0xDD,0xF5,0xBE,
+            0xDA,0xDB,0x5B,0xB5,0x6D,0x6A,0x55,0x08,0x0E,0xFB,0xBA,0xFA,0xFF,0xF7,0xFF,0xAB,
+            0xF8,0x00,0x02,0x08,0x05,0xAB,0x6E,0xBE,0xD5,0xB7,0x6F,0xEE,0xDF,0xB7,0xBE,0x00,
+            0x40,0x8B,0xAD,0xDF,0x5F,0x55,0x5D,0x55,0xFE,0xBC,0x00,0x10,0x21,0x0E,0xFD,0xB7,
+            0xEB,0x6E,0xDB,0xB5,0x5B,0x6A,0xDA,0xD5,0x55,0x08,0x0E,0xFE,0xEB,0xEB,0xFF,0xF7,
+            0xFF,0x57,0xD4,0xFE,0x00,0x7F,0x07,0x56,0xFA,0xB5,0xB5,0xBD,0x7F,0xED,0xBF,0x6F,
+            0x7F,0x00,0x22,0x0D,0xB7,0x7D,0x7D,0x55,0x5D,0x6D,0xFA,0xFE,0x00,0x00,0x80,0x25,
+            0xEB,0x5F,0xDE,0xDE,0xD7,0xAA,0xBE,0xEA,0xDA,0xD5,0xC9,0x00,0x8E,0xFB,0xAF,0xAF,
+            0xFF,0xF7,0xF7,0x5F,0x57,0x00,0x22,0x04,0x07,0x5D,0xEA,0xEB,0x6B,0x7A,0xFF,0xD7,
+            0x7F,0x77,0x7B,0x60,0x10,0x1B,0xBD,0xF5,0xF5,0x55,0xBD,0xBD,0xF5,0xFD,0x00,0x00,
+            0x10,0x0D,0xEE,0xBF,0x5D,0xBD,0xAF,0x55,0x7B,0xAB,0xDD,0xAD,0xF0,0x82,0x0D,0xDE,
+            0xBE,0xBF,0xFF,0xEF,0xDF,0x7F,0xB7,0x80,0x00,0x00,0x87,0x77,0xEB,0xB6,0xD6,0xF5,
+            0xFF,0xAD,0xFD,0x77,0xF6,0xBC,0x00,0x5E,0xFF,0xD7,0xD5,0x55,0x7A,0xF5,0xDF,0xFF,
+            0x00,0x11,0x00,0x05,0xBA,0xBD,0x11,0x6B,0x7B,0x5E,0xAA,0xF6,0xAF,0xDD,0x5B,0xD6,
+            0x24,0x0B,0x6F,0xFA,0xFF,0xFF,0xDF,0xBF,0xF4,0xFE,0x00,0x15,0x10,0x07,0xDF,0xEE,
+            0xDD,0xAD,0xEB,0xFF,0x5F,0xF5,0x77,0xFD,0x7F,0x00,0x9D,0xBE,0xDF,0x55,0x6D,0xF6,
+            0xFF,0x40,0xFE,0x00,0x14,0x02,0x22,0xEA,0xB5,0xB6,0xF6,0xBD,0x55,0xF5,0x5F,0xBA,
+            0xAF,0xAB,0x82,0x16,0xFF,0xEB,0xFF,0xFF,0x5F,0xF0,0xFE,0x00,0x15,0x22,0x00,0x03,
+            0xBF,0xEE,0xDB,0x5B,0xD7,0xFE,0xBF,0xF5,0xDF,0xF5,0xDD,0xC8,0x1D,0xDF,0xBD,0x56,
+            0xAB,0xFB,0x80,0xFD,0x00,0x13,0x40,0x03,0xEA,0xB5,0xB6,0xED,0x7A,0xAB,0xD5,0x5E,
+            0xEA,0xBE,0xEB,0x60,0xB7,0x7D,0xEF,0xFF,0xFE,0xEE,0xFC,0x00,0x13,0x08,0x83,0x7F,
+            0xDE,0xDB,0x5B,0xAF,0xFE,0xFF,0xFB,0xFF,0xD7,0x7D,0xB0,0x3B,0xFF,0xF5,0x6A,0xDB,
+            0xF8,0xFD,0x00,0x14,0x10,0x00,0x0B,0xB7,0x6B,0x6D,0xED,0xF5,0x57,0x55,0xEE,0xBA,
+            0xFB,0xAE,0xF8,0x2D,0x7F,0x5F,0xFF,0xFF,0xA0,0xFD,0x00,0x14,0x02,0x00,0x01,0xFD,
+            0xFB,0xB6,0xB6,0xBF,0xFB,0xFF,0x51,0x4F,0x56,0xF7,0x5C,0x77,0xDB,0xF5,0xAD,0xB6,
+            0x80,0xFC,0x00,0x12,0x44,0x41,0xB7,0x5D,0x6D,0xDB,0xD5,0x5D,0x5D,0x0A,0x25,0xFB,
+            0xBB,0xEF,0xDA,0xFF,0xBF,0x7F,0xFE,0xFC,0x00,0x13,0x20,0x00,0x01,0xFD,0xEB,0xB6,
+            0xEE,0xBF,0xEF,0xF4,0xA1,0x53,0xAD,0xDD,0x5B,0x6F,0xFE,0xD5,0xED,0xB8,0xFC,0x00,
+            0x13,0x02,0x00,0x01,0xD6,0xBD,0x6F,0x5B,0xEA,0xB5,0xD2,0x14,0x08,0xF6,0xEB,0xF6,
+            0xF5,0x77,0xFF,0x7F,0xF0,0xFB,0x00,0x12,0x22,0x48,0xFB,0xD7,0xB5,0xED,0x5F,0xDF,
+            0x88,0x81,0x44,0xDF,0x7D,0x5B,0x5F,0xFE,0xAB,0xDB,0xC0,0xFC,0x00,0x13,0x10,0x00,
+            0x00,0xDD,0x7D,0x6E,0xB7,0xF5,0x76,0x52,0x10,0x12,0x75,0xAF,0xEF,0xEA,0xFF,0xFE,
+            0xFF,0x80,0xFC,0x00,0x12,0x01,0x00,0x00,0xEB,0xAF,0xB7,0xDA,0xAF,0xBD,0x00,0x42,
+            0x01,0x3E,0xFA,0xB5,0x5F,0xDA,0xAB,0xBB,0xFA,0x00,0x11,0x10,0x41,0x5D,0xF5,0x7A,
+            0xBF,0xFA,0xD8,0xA4,0x00,0x48,0x9B,0x5F,0xDF,0xF5,0xFF,0xFE,0xFE,0xFB,0x00,0x12,
+            0x20,0x02,0x05,0xEF,0xAF,0xAF,0xD5,0x57,0x75,0x00,0x08,0x02,0x5D,0xEA,0xB5,0x5F,
+            0xEA,0xAB,0xDC,0xFB,0x00,0x12,0x02,0x00,0x01,0x54,0xF5,0xF5,0x7F,0xFD,0xE0,0x00,
+            0x21,0x10,0x0E,0xBF,0xDF,0xEA,0xBF,0xFE,0xF8,0xFA,0x00,0x11,0x40,0x23,0xFC,0x3E,
+            0xAF,0xAA,0xAB,0xCA,0x41,0x00,0x05,0x4D,0xEA,0xEA,0xBF,0xD5,0x57,0x58,0xFB,0x00,
+            0x12,0x10,0x08,0x82,0xAA,0xAB,0xF5,0xFF,0xFF,0x20,0x00,0x00,0x40,0x27,0x5F,0x7F,
+            0xD5,0x7F,0xFB,0xEC,0xF9,0x00,0x11,0x03,0xB8,0x1E,0xBE,0xAA,0xAB,0x08,0x00,0x04,
+            0x09,0x16,0xF5,0xAA,0xFF,0xD5,0x5D,0x7F,0xC0,0xFC,0x00,0x13,0x02,0x00,0x02,0xDA,
+            0x1B,0xD5,0xFD,0xFE,0xA0,0x00,0x00,0x20,0x47,0x5E,0xFF,0x55,0x7F,0xEF,0xAB,0x78,
+            0xFC,0x00,0x13,0x20,0x44,0x47,0x70,0x9D,0x7E,0xAB,0x54,0x00,0x00,0x20,0x84,0x15,
+            0xEB,0xAB,0xFF,0xAA,0xB5,0xFD,0xDE,0xFD,0x00,0x15,0x01,0x00,0x00,0x02,0xF4,0x0F,
+            0xAB,0xFE,0xFD,0x00,0x01,0x02,0x01,0x47,0x5E,0xFD,0x55,0xFF,0xFE,0xAB,0x6B,0xC0,
+            0xFE,0x00,0x15,0x03,0x02,0x00,0x07,0x60,0x0A,0xFD,0x55,0xB8,0x40,0x00,0x00,0x10,
+            0x13,0xF7,0x57,0xFE,0xAA,0xAB,0xFD,0xBE,0xF0,0xFE,0x00,0x08,0x03,0x10,0x11,0x05,
+            0xB0,0x0F,0x57,0xFE,0xEA,0xFE,0x00,0x09,0x42,0x46,0xAD,0xFA,0xAB,0xFF,0xFE,0xAE,
+            0xEB,0xBE,0xFE,0x00,0x15,0x0F,0x00,0x40,0x26,0xE4,0x0B,0xFA,0xAB,0xB0,0x00,0x00,
+            0x08,0x00,0x13,0xDE,0xAF,0xFE,0xAA,0xAB,0xF7,0x5D,0x6F,0xFE,0x00,0x08,0x0F,0x00,
+            0x00,0x07,0x60,0x0D,0x5F,0xF6,0xE4,0xFE,0x00,0x2E,0x12,0x45,0x77,0xF5,0x57,0xFF,
+            0xFE,0xBB,0xEB,0xB5,0xC0,0x00,0x00,0x3F,0x22,0x04,0x0A,0xD0,0x07,0xEA,0xAD,0xC8,
+            0x00,0x00,0x01,0x00,0x13,0xAD,0x5F,0xFA,0xB6,0xD7,0xDD,0x7D,0xDF,0x70,0x00,0x00,
+            0x3D,0x00,0x10,0x47,0x60,0x06,0xBF,0xF7,0xA0,0xFE,0x00,0x46,0x09,0x0A,0xFB,0xEA,
+            0xAF,0xFB,0xFA,0xEB,0xAA,0xB5,0xF8,0x00,0x00,0x7F,0x00,0x40,0x0B,0xC8,0x07,0xD5,
+            0x5A,0x88,0x00,0x00,0x40,0x40,0x43,0xAE,0xBF,0xF5,0x5E,0xAF,0x7D,0xDF,0xDE,0xAE,
+            0x00,0x00,0xFF,0x11,0x01,0x05,0x60,0x05,0x7F,0xB7,0xA0,0x00,0x00,0x01,0x04,0x15,
+            0xDB,0xD5,0x5F,0xF7,0xFB,0xAE,0xB5,0x6B,0xDF,0x00,0x01,0xF7,0x00,0x04,0x0F,0xC0,
+            0x07,0xAA,0xDD,0xFE,0x00,0x16,0x04,0x11,0x03,0x6E,0xBF,0xEA,0xDD,0xBD,0xF7,0xDE,
+            0xDD,0x75,0xC0,0x03,0xFF,0x00,0x10,0x05,0x48,0x02,0xFF,0x77,0x40,0xFD,0x00,0x13,
+            0x55,0xBB,0xEA,0xBF,0xB7,0xEF,0x5A,0xEB,0x6B,0xAF,0xE0,0x07,0xDF,0x22,0x00,0x4E,
+            0xC0,0x07,0x55,0xDE,0xFD,0x00,0x15,0x44,0x03,0xDD,0x5F,0xD5,0xFD,0x75,0xFF,0x5D,
+            0xBD,0x75,0x70,0x0F,0xFD,0x00,0x01,0x05,0xC0,0x03,0xFE,0xB4,0x80,0xFE,0x00,0x14,
+            0x01,0x55,0x6F,0xEA,0xFF,0x5F,0xDF,0x55,0xEE,0xD7,0xBF,0xB8,0x1F,0x7F,0x00,0x44,
+            0x06,0xD0,0x01,0x55,0xDD,0xFE,0x00,0x15,0x4A,0x10,0x03,0xB5,0x7F,0x55,0xF5,0x75,
+            0xFE,0xB5,0xFA,0xD5,0x6C,0x3F,0xF7,0x11,0x00,0x07,0x80,0x03,0xFE,0xFC,0xFE,0x00,
+            0x15,0x1E,0x02,0x55,0xDF,0xAA,0xFF,0x5F,0xDF,0x57,0xDE,0xAF,0x7B,0xBE,0x7B,0xDF,
+            0x00,0x00,0x45,0xC0,0x01,0x57,0x59,0xFE,0x00,0x15,0x1F,0x88,0x03,0x75,0xFF,0xAB,
+            0xF6,0xF7,0xFA,0xEB,0xDA,0xD6,0xD7,0x7F,0xFF,0x00,0x11,0x06,0xA0,0x01,0xFA,0xE8,
+            0xFE,0x00,0x15,0x3F,0x81,0x56,0xDE,0xAA,0xFD,0x5F,0xBD,0x5F,0x7D,0x6F,0x7B,0x7B,
+            0xFE,0xFD,0x24,0x40,0x07,0x80,0x01,0x57,0xBA,0xFE,0x00,0x15,0x7F,0xC4,0x03,0xB7,
+            0xFF,0x57,0xF5,0xEF,0xEB,0xAB,0xB5,0xAD,0xAD,0xB7,0xEF,0x00,0x00,0x05,0xD0,0x00,
+            0xFD,0x70,0xFE,0x00,0x15,0x6F,0xC0,0xAA,0xED,0x55,0xFD,0xBF,0x7A,0xBD,0xFD,0xDE,
+            0xF6,0xF6,0xFF,0xFF,0x00,0x04,0x46,0x80,0x03,0xAB,0xD2,0xFE,0x00,0x15,0x47,0xC2,
+            0x07,0xBB,0xFE,0xAF,0xED,0xDF,0xEE,0xAE,0xEB,0x5B,0xAD,0xBF,0x7F,0x02,0x20,0x03,
+            0xC0,0x07,0xFD,0x70,0xFE,0x00,0x15,0xCF,0xE0,0xA6,0xEE,0xAB,0xF5,0x7F,0x75,0xBB,
+            0xF5,0xBD,0xED,0x76,0xDB,0xF7,0x20,0x00,0x02,0xA0,0x07,0xAF,0xE4,0xFE,0x00,0x15,
+            0xFF,0xC4,0x17,0x77,0xFD,0x5F,0xD5,0xDF,0xEE,0xAE,0xD6,0xB7,0xBB,0x7F,0xDF,0x00,
+            0x02,0x23,0xC0,0x0D,0xD5,0x60,0xFE,0x00,0x15,0xFF,0xE1,0x05,0xBA,0xAF,0xF5,0x7F,
+            0xF6,0xBB,0xFB,0x7B,0xDD,0x6D,0xD7,0x7F,0x04,0x88,0x02,0xA0,0x09,0xFF,0xD0,0xFE,
+            0x00,0x15,0xFF,0xE0,0x57,0xDF,0xF5,0x5F,0xDA,0xBF,0xEE,0xAD,0xDD,0x77,0xB6,0xBD,
+            0xFD,0x10,0x00,0x03,0xC0,0x09,0xD5,0x60,0xFE,0x00,0x15,0xFF,0xE4,0x0D,0x6A,0xAF,
+            0xF6,0xFF,0xEA,0xBB,0xF7,0x6F,0xD5,0xDB,0xD7,0xF7,0x00,0x00,0x81,0x50,0x0F,0xEF,
+            0xC0,0xFE,0x00,0x15,0xFF,0xE1,0x4F,0xBF,0xFA,0xBB,0xAD,0xBF,0xEE,0xBD,0xB5,0x40,
+            0xED,0x7D,0xDF,0x00,0x44,0x01,0xC0,0x0F,0xF5,0x48,0xFE,0x00,0x15,0xFF,0xE0,0x2A,
+            0xEA,0xAF,0xDE,0xFF,0xF6,0xFB,0xD7,0xFE,0x02,0x37,0xAB,0xFF,0x22,0x00,0x11,0x40,
+            0x0F,0xFF,0xC0,0xFE,0x00,0x2D,0xFF,0xE4,0x8F,0xBF,0xF5,0x77,0xB6,0xDF,0xAE,0xFA,
+            0xA8,0x08,0x9A,0xDE,0xFD,0x00,0x00,0x41,0xE0,0x0F,0xF5,0x80,0x00,0x00,0x01,0xFF,
+            0xE0,0x2D,0xD5,0x5F,0xDD,0xFF,0xF5,0xFB,0x5F,0xF8,0x00,0x5F,0x6B,0xBF,0x00,0x22,
+            0x00,0xC8,0x0F,0xFB,0xFD,0x00,0x14,0xFF,0xE5,0x1E,0xFF,0xEA,0xF7,0x55,0x7F,0x5F,
+            0xEA,0xA0,0x01,0x0A,0xDD,0xF7,0x11,0x00,0x00,0xC0,0x0F,0xF8,0xFD,0x00,0x14,0xFF,
+            0xE0,0x57,0x55,0x7F,0x5D,0xFF,0xDB,0xF5,0x7F,0xC0,0x04,0x4F,0x6B,0x7F,0x00,0x00,
+            0x10,0xE0,0x07,0xF8,0xFD,0x00,0x14,0xFF,0xE2,0x1B,0xFF,0xAB,0xF7,0x6E,0xFE,0xDF,
+            0xAA,0x80,0x20,0x25,0xBD,0xDF,0x00,0x11,0x00,0xA0,0x0F,0xF8,0xFD,0x00,0x14,0xFF,
+            0xE0,0xBE,0xAA,0xFD,0x5D,0xFB,0xAB,0xF5,0xFF,0x00,0x01,0x1E,0xD6,0xFD,0x24,0x40,
+            0x00,0x64,0x07,0xFC,0xFD,0x00,0x14,0xFF,0xCA,0x37,0xFF,0xAF,0xF7,0xBF,0xFE,0xBF,
+            0x56,0x00,0x04,0xA7,0x7B,0x6F,0x00,0x00,0x24,0x60,0x07,0xF8,0xFD,0x00,0x14,0xFF,
+            0xE0,0xBA,0xAA,0xF5,0x7D,0xED,0xB7,0xED,0xFC,0x00,0x00,0x1B,0xAD,0xBF,0x00,0x04,
+            0x00,0x60,0x07,0xF8,0xFD,0x00,0x14,0xFF,0xC2,0x6F,0xFF,0xBF,0xD7,0x7F,0xFD,0xBF,
+            0x58,0x00,0x4A,0xAD,0x76,0xFF,0x02,0x20,0x80,0x30,0x03,0xFC,0xFD,0x00,0x14,0x7F,
+            0xC8,0x7A,0xAA,0xD5,0x7D,0xD6,0xDF,0xEB,0xF0,0x00,0x00,0x9F,0xDB,0xAD,0x20,0x00,
+            0x02,0x24,0x07,0xF8,0xFD,0x00,0x14,0xFF,0xC2,0xDF,0xFF,0xFF,0xDF,0x7F,0xF5,0x7E,
+            0xA0,0x02,0x15,0x2A,0xBD,0x7F,0x00,0x00,0x08,0x30,0x03,0xF8,0xFD,0x00,0x14,0x7F,
+            0x88,0xEA,0xAA,0xAA,0xF7,0xED,0xBF,0xDB,0xE0,0x00,0x42,0x7F,0xD7,0xDF,0x04,0x88,
+            0x80,0x10,0x03,0xF8,0xFD,0x00,0x01,0x7F,0x82,0xFE,0xFF,0x0F,0xBD,0xBF,0xED,0xFE,
+            0xC0,0x00,0x14,0xAA,0xFA,0xF7,0x10,0x00,0x02,0xF8,0x01,0xF8,0xFD,0x00,0x14,0x3F,
+            0x91,0xB5,0x55,0x56,0xEF,0xF6,0xFF,0x57,0x80,0x02,0x41,0xFF,0x5F,0x5F,0x00,0x00,
+            0x0F,0xFF,0x81,0xF8,0xFD,0x00,0x14,0x3F,0x05,0xD4,0xAB,0xFF,0xBA,0xDF,0xB7,0xFD,
+            0x00,0x08,0x2B,0x55,0xEA,0xFD,0x00,0x44,0x5F,0xD7,0xF0,0xF0,0xFE,0x00,0x15,0x04,
+            0x0C,0x53,0x4A,0x14,0x55,0xEF,0xFB,0xFD,0x6E,0x00,0x21,0x47,0xFF,0x7F,0x57,0x22,
+            0x00,0x1F,0x00,0xFC,0x70,0xFC,0x00,0x13,0x06,0xA0,0x82,0xBF,0x7D,0xBE,0xDF,0xFE,
+            0x00,0x04,0x1D,0x6B,0xAB,0xFF,0x00,0x00,0x3F,0x00,0x1F,0x80,0xFE,0x00,0x15,0x20,
+            0x41,0x2C,0x08,0x29,0x55,0xD7,0xEF,0xF6,0xAC,0x00,0x12,0xBF,0xFE,0xFD,0x5F,0x00,
+            0x22,0x1F,0xC0,0x07,0xC0,0xFD,0x00,0x14,0x08,0x12,0xA1,0x00,0x5F,0x7E,0xFB,0x7F,
+            0xF8,0x01,0x00,0x6B,0x5B,0xD7,0xF7,0x11,0x00,0x3F,0xE0,0x07,0xF0,0xFE,0x00,0x16,
+            0x02,0x01,0x54,0x00,0x02,0x27,0xEF,0xBF,0xDB,0x70,0x04,0x55,0x7F,0xFE,0xFD,0x7F,
+            0x00,0x00,0x1F,0xF8,0x03,0xF9,0x20,0xFE,0x00,0x7F,0x44,0x21,0x04,0x20,0x96,0xBB,
+            0xED,0xFF,0xD0,0x10,0x09,0xED,0xB7,0xDF,0xDB,0x00,0x11,0x17,0xFF,0x9F,0xFC,0x94,
+            0x00,0x01,0x10,0x11,0x50,0x20,0x00,0x2B,0xFE,0xFF,0x6A,0xE0,0x01,0x53,0xBF,0xFD,
+            0x77,0x7F,0x24,0x40,0x0F,0xFF,0xFF,0xFE,0x4A,0x00,0x08,0x01,0x02,0x04,0x01,0x04,
+            0x0B,0xAF,0xB7,0xFF,0xC0,0x84,0x27,0xFE,0xFF,0xFD,0xEF,0x00,0x00,0x05,0xFF,0xFF,
+            0xFE,0x01,0x41,0x00,0x04,0x49,0x40,0x84,0x50,0xAB,0xFB,0xFD,0xB6,0xC0,0x11,0x4F,
+            0xF7,0xDF,0xFF,0xBF,0x00,0x04,0x43,0x7F,0xFF,0xFF,0x12,0x28,0x00,0x90,0x14,0x00,
+            0x12,0xAA,0x0B,0x7E,0xDF,0xFF,0x84,0x44,0x9E,0xDF,0xFB,0xBF,0xFD,0x82,0x20,0x00,
+            0xD7,0xFF,0xFE,0x80,0x94,0x42,0x01,0x41,0x12,0x05,0x1A,0x48,0x25,0xDB,0xF6,0xDB,
+            0x80,0x12,0x5F,0xFF,0x7F,0xF7,0xF7,0xC8,0x00,0x00,0x3D,0xFF,0xFE,0xC0,0x02,0xA8,
+            0x4A,0x28,0x00,0x15,0xF6,0x15,0xFE,0xFF,0x33,0x12,0x8A,0x7F,0xFD,0xFF,0xFE,0xFF,
+            0xE0,0x02,0x10,0x07,0x6F,0xFD,0x44,0x20,0x15,0x24,0x80,0x00,0x42,0x39,0x4B,0xB7,
+            0x03,0x56,0x00,0x55,0x7B,0xB7,0xED,0xBF,0xDF,0xF0,0x88,0x40,0x01,0xBD,0xF5,0x60,
+            0x84,0x80,0x80,0x02,0x44,0x08,0xAC,0x15,0xFE,0x01,0xFE,0x4A,0xA9,0xFE,0xFF,0x23,
+            0xFB,0xFD,0x78,0x00,0x02,0x00,0x4B,0x55,0x50,0x00,0x04,0x11,0x10,0x00,0x82,0xA6,
+            0x95,0xD8,0x04,0x74,0x24,0x95,0xDF,0xFF,0x7F,0xEF,0xF7,0x78,0x20,0x08,0x48,0x80,
+            0xAA,0xA2,0x20,0x20,0xFE,0x00,0x26,0x10,0xEA,0x2B,0xF8,0x11,0x7D,0x52,0x53,0xFD,
+            0xBB,0xF7,0x7F,0x7F,0x1C,0x02,0x20,0x00,0x54,0xAA,0xB0,0x04,0x81,0x04,0x00,0x44,
+            0x42,0x82,0x95,0xB0,0x04,0x39,0x00,0x0F,0xFF,0xFF,0xDF,0xFD,0xFF,0x1E,0xFE,0x00,
+            0x15,0x22,0x55,0x50,0x80,0x04,0x20,0x49,0x00,0x0A,0xA8,0x57,0xE0,0x01,0x58,0x00,
+            0x03,0xB7,0xEF,0x7F,0xEF,0xEF,0x0F,0xFE,0x00,0x7F,0x14,0xAA,0xA8,0x10,0x10,0x00,
+            0x00,0x01,0x05,0x02,0x2B,0x40,0x14,0xB0,0x00,0x49,0xFF,0x7F,0xFB,0x7F,0xBD,0x07,
+            0x80,0x00,0x00,0x12,0x55,0x54,0x42,0x40,0x82,0x00,0x20,0x56,0x90,0xAB,0xC0,0x02,
+            0x40,0x00,0x00,0xFF,0xFB,0xFF,0xFE,0xFF,0x03,0x80,0x00,0x00,0x09,0x55,0x54,0x00,
+            0x02,0x10,0x10,0x84,0x18,0x04,0xAF,0x80,0x11,0x00,0x02,0x0A,0x77,0xEF,0xBF,0xEF,
+            0xFF,0x01,0xC0,0x50,0x00,0x04,0x2A,0xAA,0x20,0x08,0x00,0x82,0x00,0xA4,0x91,0x57,
+            0x80,0x45,0x00,0x08,0x21,0x7E,0xFF,0xF6,0xFF,0xEF,0x01,0xE7,0xFE,0x00,0x02,0xAA,
+            0xA8,0x84,0x80,0x42,0x00,0x11,0x50,0x04,0xAF,0x00,0x12,0x00,0x20,0x84,0x3F,0xFD,
+            0xFF,0xFB,0xBD,0x00,0xFF,0xFF,0x80,0x02,0x95,0x54,0x7F,0x10,0x02,0x08,0x10,0x05,
+            0x02,0x42,0xAF,0x00,0x08,0x01,0x02,0x22,0xBB,0xB7,0xDF,0xBF,0xFF,0x00,0x7F,0x5F,
+            0xC0,0x00,0xAA,0xAA,0x80,0x48,0x00,0x40,0xAA,0x48,0x15,0x5F,0x00,0xA4,0x04,0x28,
+            0x94,0x5F,0xFF,0xFD,0xFE,0xFF,0x00,0x3C,0x03,0xE0,0x00,0x4A,0xAA,0x12,0x00,0x42,
+            0x04,0x50,0x01,0x4A,0xBF,0x00,0x10,0x20,0x8A,0xA2,0xBF,0xFE,0xFF,0xF7,0xEF,0x00,
+            0x70,0x00,0xF0,0x00,0x29,0x55,0x40,0x22,0x08,0x12,0x82,0x44,0x2B,0x7B,0x00,0x48,
+            0x05,0x20,0x1A,0xBD,0xBB,0xEF,0xBF,0xFD,0x00,0xE0,0x00,0x70,0x00,0x15,0x2A,0x12,
+            0x00,0x20,0x80,0x08,0x11,0x2A,0xFF,0x02,0x21,0x28,0x00,0x05,0x77,0xFF,0xFE,0xFF,
+            0x7F,0x01,0xE2,0x00,0x38,0x00,0x0A,0xA9,0x40,0x91,0x02,0x51,0x08,0x41,0x04,0xAA,
+            0xEF,0x00,0x90,0x10,0x00,0x01,0x7F,0xEF,0x7B,0xFB,0xF7,0x01,0xC0,0x00,0x38,0x00,
+            0x02,0xAA,0xAA,0x04,0x10,0x42,0x08,0x52,0xAB,0xFB,0x00,0x52,0xA0,0x00,0x00,0x5F,
+            0x7F,0xFD,0x55,0x5A,0x01,0xC0,0x00,0x3C,0x00,0x01,0x55,0x00,0xA0,0x82,0x08,0x42,
+            0x0A,0xAB,0xBF,0x92,0x48,0x80,0x00,0x00,0x7D,0xFD,0xEA,0xAA,0xAA,0x03,0x88,0x00,
+            0x1C,0x00,0x00,0xAA,0xB5,0x0A,0x28,0xA2,0x11,0x6A,0xD7,0xEB,0x01,0x25,0xFE,0x00,
+            0x15,0x17,0xF7,0xFD,0x56,0xD7,0x01,0x80,0x00,0x1C,0x00,0x00,0x2A,0x94,0xA0,0x82,
+            0x09,0x4A,0x95,0x3E,0xBF,0x94,0xB5,0xFE,0x00,0x53,0x1F,0xDF,0xBB,0xFD,0xFD,0x03,
+            0x80,0x00,0x1C,0x00,0x00,0x0A,0xAA,0x95,0x51,0x54,0x2A,0xAA,0xFB,0xF6,0xC2,0xA4,
+            0x42,0x49,0x12,0x4D,0xFF,0xFD,0xFF,0xFF,0x01,0xC0,0x00,0x18,0x00,0x00,0x02,0xAA,
+            0xAA,0x2A,0x4B,0xAA,0xAB,0xD7,0xBF,0xC9,0x55,0x08,0x00,0x40,0x17,0xFD,0xFA,0xFF,
+            0xFF,0x01,0xC0,0x00,0x3C,0x80,0x00,0x00,0x55,0x55,0xAA,0xA8,0xAA,0xAD,0x7E,0xEB,
+            0x60,0x08,0xA2,0xAA,0x09,0x5B,0x77,0xDD,0xFF,0xFF,0x81,0xC0,0x00,0x38,0xFE,0x00,
+            0x15,0x0A,0xAA,0xAA,0xAE,0xAA,0xBF,0xFB,0xBF,0x95,0x55,0x15,0x55,0xA4,0x0D,0xFF,
+            0xFA,0xFF,0xFF,0xC1,0xE0,0x00,0x38,0xFE,0x00,0x15,0x01,0x25,0x55,0x52,0xA5,0xEB,
+            0xBE,0xEB,0x0A,0xAC,0xD4,0x00,0x2A,0xAF,0x7E,0xFD,0xFF,0x77,0x50,0xE0,0x00,0x71,
+            0xFD,0x00,0x14,0x10,0x2A,0xA9,0x2F,0x7F,0xEB,0xBE,0x01,0x2A,0x50,0x00,0x15,0x55,
+            0xEF,0xED,0xF7,0xFF,0xA8,0xF0,0x00,0xF0,0xFD,0x00,0x14,0x6D,0x40,0x0A,0xFD,0xEE,
+            0xBE,0xEC,0x00,0x05,0x40,0x00,0x05,0x1E,0xBF,0xBD,0xFF,0xDF,0xA8,0x78,0x01,0xE0,
+            0xFD,0x00,0xFE,0xFF,0x11,0xF7,0xBB,0xEB,0xB8,0x00,0x46,0x00,0x00,0x02,0xB5,0xFD,
+            0xFA,0xFD,0xFD,0x56,0x3E,0x0F,0xC0,0xFE,0x00,0x15,0x01,0xAB,0x77,0xFF,0x5F,0xFD,
+            0x7E,0xF2,0x42,0x14,0x00,0x00,0x01,0x5B,0x5F,0xFD,0xF7,0xFF,0xAB,0x1F,0xFF,0x84,
+            0xFE,0x00,0x14,0x07,0xF5,0x5D,0xB5,0xFD,0xAF,0xAB,0xB0,0x00,0x05,0x40,0x00,0x00,
+            0xB6,0xFF,0xDD,0xFF,0xB7,0xA9,0x47,0xFE,0xFD,0x00,0x15,0x16,0x88,0x86,0xFF,0xEE,
+            0xF5,0xFE,0xF4,0x00,0x50,0x00,0x00,0x48,0xDB,0x56,0xFC,0xFE,0xFF,0x55,0x41,0xF0,
+            0x10,0xFE,0x00,0x13,0xBA,0x55,0x51,0x5B,0x77,0x5E,0xAB,0xA1,0x01,0x0A,0x80,0x02,
+            0x00,0x6D,0xFF,0xFE,0xFB,0xFF,0xAA,0xB0,0xFD,0x00,0x14,0x02,0xA9,0x24,0xAA,0x5E,
+            0xAA,0xEB,0xFE,0xE8,0x10,0x00,0xA0,0x10,0x48,0xDB,0x57,0xED,0xFF,0xED,0xAA,0x94,
+            0xFD,0x00,0x14,0x0A,0xEA,0x92,0x49,0x45,0xDF,0x7D,0xAB,0xA5,0x00,0x49,0x09,0x05,
+            0x22,0x6D,0xBF,0x7E,0xFF,0xBF,0x55,0x54,0xFD,0x00,0x14,0x29,0x40,0x49,0x24,0x92,
+            0xB5,0xAB,0x16,0xF2,0x49,0x04,0xD0,0xA0,0x88,0xF6,0xEB,0xFA,0xFB,0xFF,0xAA,0xAA,
+            0xFD,0x00,0x14,0x95,0x95,0x2A,0x92,0x01,0x5A,0xFE,0x03,0xA9,0x00,0x02,0x2A,0x15,
+            0x22,0x5B,0xBF,0xEE,0xFF,0xFB,0xAA,0xAB,0xFE,0x00,0x01,0x02,0x4A,0xFE,0x00,0x69,
+            0xA8,0xAF,0x54,0x95,0x75,0x50,0x02,0x15,0x44,0x08,0xEE,0xD5,0xFD,0x7E,0xEF,0x55,
+            0x55,0xC0,0x00,0x00,0x05,0x2A,0x00,0x00,0x48,0x04,0x35,0xBC,0x01,0xD2,0xA0,0x01,
+            0x40,0x28,0x80,0xDB,0x7F,0xBE,0xFB,0xFF,0xAA,0xAA,0x50,0x00,0x00,0x10,0xAC,0x02,
+            0x49,0x02,0x42,0x9A,0xD5,0x4A,0xF1,0x52,0x01,0x55,0xA0,0x29,0xFD,0xD6,0xFD,0xFF,
+            0xFF,0xAA,0xAA,0xA8,0x00,0x00,0x0A,0x50,0x48,0x00,0x10,0x10,0x4F,0x6C,0x01,0x49,
+            0x40,0x00,0x54,0x01,0x01,0x57,0x7B,0xEE,0xFF,0xBB,0x55,0x55,0x54,0x00,0x00,0x41,
+            0x58,0x00,0x00,0x42,0x45,0x25,0xB6,0x95,0x84,0x60,0xFE,0x00,0x05,0x53,0xFB,0xAE,
+            0xB5,0x7D,0xFF,0xFE,0xAA,0x15,0x00,0x00,0x2A,0xA0,0x01,0x24,0x08,0x10,0x96,0xDA,
+            0x40,0x85,0x12,0x00,0x00,0x04,0x06,0xAE,0xFB,0x55,0x7F,0xEF,0xFE,0xAA,0x15,0x00,
+            0x01,0x01,0x51,0x10,0x00,0x81,0x04,0x43,0x6F,0x0A,0x81,0x20,0x00,0x00,0x01,0x47,
+            0xFB,0xAF,0xBB,0xFF,0xBF,0xFE,0x55,0x15,0x80,0x00,0xAA,0xC0,0x00,0x00,0x10,0x42,
+            0x29,0xB5,0x41,0x20,0xA4,0x80,0x00,0x20,0x1D,0x5E,0xF5,0xEE,0xFB,0xFD,0xFE,0xAA,
+            0x12,0xC0,0x04,0x05,0x44,0x04,0x92,0x04,0x11,0x4A,0xDA,0x92,0x80,0x22,0x00,0x00,
+            0x0A,0x9B,0xEB,0xBE,0xFE,0xFF,0xFE,0xAA,0x15,0x50,0x01,0x55,0x00,0x90,0x00,0x41,
+            0x04,0x25,0x6F,0x41,0x10,0x11,0x10,0x01,0x00,0x3E,0xBE,0xD7,0xFF,0xFE,0xEF,0xFE,
+            0x55,0x12,0x50,0x08,0x16,0x20,0x00,0x00,0x04,0x41,0x52,0xB5,0x29,0x80,0x12,0x40,
+            0x24,0x54,0xEF,0xEB,0xFA,0xFE,0xFF,0xFE,0xAA,0x15,0xAC,0x02,0xA8,0x04,0x02,0x49,
+            0x10,0x14,0x14,0xDB,0x82,0x92,0x09,0x24,0x81,0x09,0xFA,0xFE,0xAF,0xBF,0xF7,0xFB,
+            0xFE,0xAA,0x15,0xA6,0x10,0x18,0x00,0x40,0x00,0x01,0x01,0x4A,0xAD,0x50,0xC0,0x08,
+            0x92,0x28,0xA3,0xBF,0xAB,0xFA,0xFB,0xBF,0x6F,0xFE,0x55,0x15,0x52,0x85,0x50,0x41,
+            0x08,0x00,0x44,0x48,0x25,0x76,0x85,0x48,0x04,0x49,0x45,0x0F,0xED,0xFE,0xAF,0xBF,
+            0xFD,0xFF,0xFD,0xAA,0x14,0xA0,0x60,0x08,0x01,0x24,0x00,0x02,0x94,0xAB,0xD0,0xA2,
+            0x02,0x14,0xA8,0x5D,0x7F,0x6B,0xF5,0xFF,0xF7,0xFF,0xFD,0xAA,0x14,0x89,0x20,0x20,
+            0x00,0x00,0x22,0x48,0x4A,0xB5,0x4A,0xB1,0x41,0x42,0x02,0xFF,0xD7,0xFE,0xBE,0xED,
+            0xBF,0xDB,0xFD,0x55,0x14,0x40,0x80,0x00,0x90,0x01,0x00,0x02,0x25,0x5D,0xA1,0x58,
+            0x24,0xA8,0xAF,0xFF,0xFD,0xB7,0xD7,0x7F,0xFF,0x7F,0xFD,0xAA,0x14,0x95,0x40,0x44,
+            0x02,0x48,0x08,0x91,0x52,0xAA,0xD4,0x8C,0x92,0xAF,0x7F,0xED,0xF7,0xFD,0xFB,0xFF,
+            0xF7,0xFF,0xFD,0xAA,0x01,0x80,0x80,0xFE,0x00,0x0F,0x42,0x04,0x0A,0xB7,0x42,0x0A,
+            0x09,0x15,0xDE,0xFF,0xBE,0xB7,0x5D,0x6E,0xDF,0xF7,0xFD,0x55,0x14,0x4A,0x80,0x20,
+            0x88,0x02,0x00,0x51,0x55,0x5A,0xE9,0x47,0xA0,0x5F,0x7B,0xFF,0xFF,0x7F,0xEF,0xFF,
+            0xFE,0xDF,0xFD,0xAA,0x14,0x80,0x80,0x84,0x01,0x20,0x11,0x04,0x4A,0xAD,0x54,0x12,
+            0xD6,0xB5,0xDF,0xDD,0xFF,0xBB,0x75,0x7F,0xFB,0xFF,0xFC,0xAA,0x13,0xA0,0x00,0x00,
+            0x01,0x04,0x22,0xA5,0x6B,0xA2,0x42,0xBB,0xFF,0x77,0xFF,0xDB,0x5F,0xDF,0xED,0xBF,
+            0xFB,0xFD,0x55,0x14,0x00,0xA0,0x40,0x90,0x08,0x20,0x88,0x15,0x36,0xD0,0x09,0x6D,
+            0x55,0xDF,0x7F,0x7F,0xBD,0xF5,0xBF,0xFF,0xBF,0xFC,0xAA,0x13,0x50,0x12,0x02,0x40,
+            0x82,0x25,0x55,0x5B,0x6A,0xA5,0x57,0xBF,0x77,0xED,0xFF,0x7F,0x7E,0xFF,0xED,0xFF,
+            0xFD,0xAA,0x14,0x81,0x58,0x80,0x00,0x02,0x10,0x00,0xAA,0xAD,0xA8,0x05,0x7A,0xD5,
+            0xBD,0xFF,0xF7,0xBF,0xDB,0xFB,0xBF,0xF7,0xFD,0x55,0x14,0x54,0x4A,0x00,0x48,0x10,
+            0x02,0xAA,0x4A,0xB6,0xE5,0x55,0x57,0x7F,0xD7,0xFF,0xDF,0x5F,0xFF,0x7F,0xFF,0xBF,
+            0xFD,0xAA,0x14,0xA1,0x2A,0x49,0x01,0x01,0x20,0x05,0x2A,0xAB,0x50,0x15,0xEA,0xD5,
+            0x7D,0xB7,0x7F,0xBF,0x6D,0xEF,0xFB,0xFF,0xFD,0xAA,0x14,0xA8,0xAA,0x00,0x00,0x24,
+            0x09,0x50,0xAA,0xBD,0xB5,0x55,0xBF,0x7F,0xD7,0xFF,0xFD,0xBF,0xFF,0xFE,0xDF,0xF7,
+            0xFD,0x55,0x14,0x54,0x15,0x20,0x48,0x80,0x80,0x0A,0xAA,0xD6,0xEA,0xAB,0xEB,0xD5,
+            0x7D,0xFF,0xF7,0xBF,0xFB,0xFB,0xFE,0xDF,0xFD,0xAA,0x14,0xA2,0xAA,0x84,0x00,0x08,
+            0x25,0x52,0x55,0x6B,0x5A,0xAF,0x7E,0xFF,0xD7,0xBB,0xBF,0x5E,0xEF,0x6F,0xFB,0xFF,
+            0xFD,0xAA,0x0D,0xA8,0x0A,0x10,0x84,0x42,0x00,0x09,0x55,0x5D,0xEA,0xBD,0xEF,0xAA,
+            0xFD,0xFC,0xFF,0x01,0xBF,0xFB,0xFD,0x55,0x14,0x56,0xA5,0x82,0x11,0x00,0x95,0x55,
+            0x55,0x6A,0xBD,0xFF,0xBB,0xFF,0xAF,0x7E,0xFB,0xBF,0xBF,0xFE,0xFF,0xDF,0xFD,0xAA,
+            0x14,0xA9,0x12,0x90,0x40,0x28,0x00,0x24,0xAA,0xB7,0xD7,0x76,0xFE,0xB6,0xF5,0xEF,
+            0xEF,0xFF,0xFB,0x77,0xF6,0xFF,0xFC,0xAA,0x13,0xA4,0x81,0x04,0x82,0xAA,0x92,0xAA,
+            0xDA,0xBD,0xFF,0xD7,0xFF,0xBF,0xFF,0xFF,0xFE,0xFF,0xFF,0xDF,0xFD,0xFC,0x55,0x13,
+            0x52,0x94,0x20,0x08,0x01,0x4A,0xAB,0x6D,0xDF,0xB7,0x7D,0xAA,0xEA,0xFB,0x7D,0xBF,
+            0xEF,0xFF,0x7F,0xDF,0xFD,0xAA,0x14,0xA8,0xC9,0x40,0x84,0xA2,0xAA,0x2A,0xA9,0xB6,
+            0xEB,0xFD,0xF7,0xFF,0x7F,0xBF,0xF7,0xFF,0xFE,0xDB,0xFD,0xFF,0xFC,0xAA,0x13,0x6A,
+            0xC8,0x10,0x08,0x05,0x55,0x56,0xDB,0x7E,0xAF,0xBE,0xDA,0xAA,0xFF,0xFF,0xF7,0x7F,
+            0xFF,0xF7,0xF7,0xFD,0x55,0x14,0x54,0x2B,0x62,0x45,0x22,0xA8,0x92,0xAB,0x6D,0xAB,
+            0xDD,0xEF,0xED,0xDB,0xB6,0xDE,0xDF,0xED,0xFE,0xDF,0x7F};
+
+static const unsigned char Doraemon []={
+            0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x9F,0x00,0x03,0x03,0xFF,0xFE,0x80,0xED,
+            0x00,0x00,0x05,0xFD,0xFF,0x00,0xA0,0xEE,0x00,0x00,0xBF,0xFD,0xFF,0x00,0xFD,0xEF,
+            0x00,0x07,0x07,0xFF,0xEA,0x00,0x00,0xAF,0xFF,0xD0,0xF0,0x00,0x07,0x3F,0xF5,0x29,
+            0x6A,0xAD,0x50,0xAF,0xFC,0xF1,0x00,0x08,0x01,0xFF,0x4A,0x95,0xBA,0xA2,0x2A,0x52,
+            0xFF,0xF1,0x00,0x09,0x07,0xF9,0x29,0x57,0xDF,0x55,0x4A,0x97,0xFF,0xE0,0xF2,0x00,
+            0x09,0x1F,0xC5,0x54,0xBC,0x01,0xD2,0xA5,0x5D,0x77,0xF8,0xF2,0x00,0x09,0xFE,0xA9,
+            0x25,0x60,0x00,0x74,0x92,0x70,0x0E,0xFE,0xF3,0x00,0x0B,0x01,0xFA,0x54,0x92,0xC0,
+            0x00,0x3A,0x55,0xC0,0x03,0x3F,0x80,0xF4,0x00,0x0B,0x07,0xE5,0x25,0x55,0x80,0x00,
+            0x0D,0x49,0x80,0x01,0xC7,0xE0,0xF4,0x00,0x0B,0x1F,0x92,0x94,0xAB,0x00,0x00,0x06,
+            0x55,0x00,0x00,0x6A,0xF0,0xF4,0x00,0x0B,0x3E,0x54,0xAA,0x4B,0x00,0x00,0x07,0x27,
+            0x00,0x00,0x75,0x7C,0xF4,0x00,0x0B,0xFA,0xAA,0x49,0x26,0x00,0x00,0x03,0x56,0x00,
+            0x00,0x19,0x5F,0xF5,0x00,0x0D,0x01,0xF5,0x25,0x25,0x54,0x00,0x00,0x01,0x94,0x00,
+            0x00,0x1A,0x5F,0x80,0xF6,0x00,0x0D,0x07,0xC9,0x52,0xAA,0x9C,0x00,0x00,0x01,0xAC,
+            0x00,0x00,0x0D,0x27,0xC0,0xF6,0x00,0x04,0x07,0xA5,0x29,0x24,0x48,0xFE,0x00,0x05,
+            0xCC,0x00,0x00,0x05,0x51,0xF0,0xF6,0x00,0x04,0x1E,0xAA,0x94,0x93,0x58,0xFE,0x00,
+            0x05,0xD8,0x00,0x00,0x06,0x95,0x78,0xF6,0x00,0x04,0x3E,0x52,0x4A,0xA8,0xB0,0xFE,
+            0x00,0x05,0x68,0x00,0x00,0x02,0x4A,0xBC,0xF6,0x00,0x04,0x79,0x29,0x52,0x4A,0x98,
+            0xFE,0x00,0x05,0x78,0x00,0x00,0x03,0x52,0x5E,0xF6,0x00,0x04,0xF5,0x4A,0x49,0x25,
+            0x50,0xFE,0x00,0x05,0x30,0x00,0x00,0x03,0x29,0x2F,0xF7,0x00,0x05,0x01,0xEA,0xA5,
+            0x2A,0xA9,0x30,0xFE,0x00,0x06,0x38,0x00,0x00,0x01,0xA5,0x57,0x80,0xF8,0x00,0x05,
+            0x03,0xD1,0x29,0x54,0x94,0xB0,0xFE,0x00,0x06,0x30,0x00,0x00,0x01,0x54,0x93,0xC0,
+            0xF8,0x00,0x05,0x07,0xAA,0x94,0x8A,0x4A,0xA0,0xFE,0x00,0x06,0x30,0x00,0x00,0x01,
+            0x92,0x49,0xE0,0xF8,0x00,0x05,0x0F,0x14,0xA5,0x52,0xA5,0x30,0xFE,0x00,0x00,0x30,
+            0xFE,0x00,0x02,0xC9,0x55,0x70,0xF8,0x00,0x0F,0x0E,0xA5,0x52,0x4A,0x52,0xA0,0x00,
+            0x00,0x38,0x10,0x3C,0x00,0x01,0xAA,0xA4,0xF8,0xF8,0x00,0x01,0x3D,0x52,0xFE,0x29,
+            0x0A,0x70,0x00,0x00,0x7C,0x30,0x7E,0x00,0x00,0xA4,0x92,0x3C,0xF8,0x00,0x0F,0x3A,
+            0x4A,0x95,0x55,0x4A,0x20,0x00,0x00,0xFE,0x10,0xFF,0x00,0x00,0xD2,0x55,0x5C,0xF8,
+            0x00,0x0F,0x79,0x29,0x4A,0x92,0xA5,0x60,0x00,0x01,0xFE,0x30,0xFF,0x00,0x00,0xAA,
+            0xA9,0x5E,0xF8,0x00,0x0F,0xF5,0x54,0xA4,0xA9,0x29,0x30,0x00,0x01,0xFF,0x10,0xFF,
+            0x00,0x00,0xD2,0x4A,0x4F,0xF8,0x00,0x10,0xE4,0x92,0x52,0x4A,0x94,0xA0,0x00,0x01,
+            0xCF,0x10,0xE7,0x80,0x01,0xA9,0x25,0x27,0x80,0xFA,0x00,0x11,0x01,0xD2,0x4A,0xAA,
+            0xA4,0xA5,0x70,0x00,0x01,0xC7,0x31,0xC7,0x00,0x00,0x95,0x52,0xAB,0x80,0xFA,0x00,
+            0x11,0x03,0xD5,0x55,0x25,0x2A,0x52,0xB0,0x00,0x01,0xC7,0x11,0xC3,0x80,0x01,0xE4,
+            0x94,0x95,0xC0,0xFA,0x00,0x11,0x03,0xAA,0x49,0x54,0xA5,0x2F,0xF0,0x00,0x01,0xC7,
+            0x38,0xC7,0x00,0x00,0xFA,0x52,0x4A,0xE0,0xFA,0x00,0x11,0x07,0x45,0x24,0x96,0x92,
+            0xFC,0x10,0x00,0x01,0xCE,0x31,0xE7,0x00,0x01,0x1F,0x4A,0xA5,0xE0,0xFA,0x00,0x11,
+            0x0F,0x29,0x55,0x4F,0x55,0xC0,0x18,0x00,0x01,0xEE,0x38,0xEF,0x00,0x01,0x03,0xA9,
+            0x2A,0x70,0xFA,0x00,0x11,0x0E,0xA4,0x92,0x53,0xDF,0x00,0x10,0x00,0x01,0xFE,0x28,
+            0xFE,0x00,0x01,0x00,0xE5,0x52,0xF0,0xFA,0x00,0x11,0x0E,0x95,0x49,0x48,0xF8,0x00,
+            0x08,0x00,0x00,0xFC,0x68,0x7E,0x00,0x03,0x00,0x3A,0x94,0x38,0xFA,0x00,0x11,0x1D,
+            0x52,0x55,0x2A,0xEC,0x00,0x0C,0x00,0x00,0x78,0x4C,0x7C,0x00,0x02,0x00,0x1C,0xA5,
+            0xB8,0xFA,0x00,0x06,0x1C,0x95,0x24,0xA7,0x8E,0x00,0x04,0xFE,0x00,0x07,0x44,0x00,
+            0x00,0x06,0x00,0x07,0x2A,0x5C,0xFA,0x00,0x06,0x3A,0x49,0x52,0x9E,0x03,0x80,0x06,
+            0xFE,0x00,0x07,0xCF,0xE0,0x00,0x04,0x00,0x03,0x93,0x2E,0xFA,0x00,0x11,0x3A,0xA4,
+            0x95,0x58,0x00,0xE0,0x02,0x00,0x00,0x01,0xBF,0xF0,0x00,0x0C,0x00,0x00,0xD7,0x9E,
+            0xFA,0x00,0x11,0x75,0x2A,0x49,0x70,0x00,0x38,0x03,0x00,0x00,0x01,0x7F,0xFC,0x00,
+            0x18,0x00,0x00,0xEC,0x4E,0xFA,0x00,0x11,0x72,0x92,0xAA,0xC0,0x00,0x0E,0x01,0x80,
+            0x00,0x03,0x7F,0xFC,0x00,0x30,0x00,0x00,0x3B,0x57,0xFA,0x00,0x11,0xE9,0x49,0x25,
+            0x80,0x00,0x03,0x00,0xC0,0x00,0x06,0xFF,0xFE,0x00,0x60,0x00,0x00,0xF8,0xA7,0xFA,
+            0x00,0x12,0xEA,0x54,0x97,0x00,0x00,0x01,0xC0,0x70,0x00,0x1D,0xFC,0xFE,0x01,0xC0,
+            0x00,0x03,0x8E,0x53,0x80,0xFB,0x00,0x02,0xE5,0x25,0x56,0xFE,0x00,0x0C,0x70,0x1C,
+            0x00,0x71,0xF8,0x3F,0xFF,0x00,0x00,0x06,0x05,0x2B,0x80,0xFC,0x00,0x03,0x01,0xD2,
+            0x92,0x4C,0xFE,0x00,0x0C,0x1C,0x0F,0xAB,0xC1,0xFC,0x7F,0x54,0x00,0x00,0x1C,0x07,
+            0x55,0x80,0xFC,0x00,0x03,0x01,0xD4,0xAA,0xB8,0xFE,0x00,0x05,0x06,0x00,0xFD,0x01,
+            0xF8,0x7F,0xFE,0x00,0x03,0x70,0x03,0x25,0xC0,0xFC,0x00,0x03,0x01,0xCA,0x49,0x30,
+            0xFE,0x00,0x05,0x03,0x80,0x00,0x01,0xFE,0xFF,0xFE,0x00,0x03,0xC0,0x01,0xAA,0xC0,
+            0xFC,0x00,0x03,0x03,0xA5,0x24,0xB0,0xFD,0x00,0x0B,0xE0,0x00,0x01,0xFF,0xFF,0x00,
+            0x00,0x03,0x80,0x00,0xD2,0xE0,0xFC,0x00,0x03,0x01,0xA9,0x55,0x60,0xFD,0x00,0x0B,
+            0x38,0x00,0x01,0xFF,0xFE,0x00,0x00,0x0E,0x00,0x00,0x69,0xE0,0xFC,0x00,0x03,0x03,
+            0xA5,0x2A,0xC0,0xFD,0x00,0x0B,0x0C,0x00,0x01,0xFF,0xFE,0x00,0x00,0x38,0x00,0x00,
+            0x64,0xE0,0xFC,0x00,0x03,0x03,0x94,0x91,0x40,0xFD,0x00,0x0B,0x07,0x00,0x00,0xFF,
+            0xFE,0x00,0x00,0x60,0x00,0x00,0x35,0x60,0xFC,0x00,0x04,0x07,0x52,0xAA,0x86,0x80,
+            0xFE,0x00,0x0B,0x01,0x00,0x00,0x7F,0xFC,0x00,0x01,0xC0,0x00,0x00,0x32,0xF0,0xFC,
+            0x00,0x05,0x03,0xAA,0x4B,0x83,0xFF,0x40,0xFC,0x00,0x03,0x7F,0xF8,0x00,0x07,0xFE,
+            0x00,0x01,0x19,0x70,0xFC,0x00,0x06,0x07,0x15,0x25,0x00,0x0B,0xFF,0x40,0xFD,0x00,
+            0x03,0x1F,0xF0,0x00,0x0C,0xFE,0x00,0x01,0x1A,0x70,0xFC,0x00,0x07,0x07,0x52,0xAB,
+            0x00,0x00,0x05,0xFF,0xD0,0xFE,0x00,0x01,0x0F,0xC0,0xFC,0x00,0x01,0x0D,0x30,0xFC,
+            0x00,0x02,0x07,0x49,0x56,0xFE,0x00,0x02,0x05,0x7F,0xD0,0xFE,0x00,0x00,0x80,0xFD,
+            0x00,0x02,0x01,0x5F,0x78,0xFC,0x00,0x02,0x06,0xAA,0x4A,0xFD,0x00,0x01,0x02,0xBE,
+            0xFE,0x00,0x00,0x80,0xFE,0x00,0x03,0x02,0xFF,0xEE,0xB8,0xFC,0x00,0x02,0x07,0x25,
+            0x2C,0xF8,0x00,0x07,0x80,0x00,0x00,0x02,0xFF,0xEF,0x05,0x38,0xFC,0x00,0x02,0x0E,
+            0x92,0xA4,0xF8,0x00,0x07,0x80,0x00,0x00,0xBF,0xA1,0x80,0xC2,0xB8,0xFC,0x00,0x02,
+            0x0E,0xA9,0x2C,0xF8,0x00,0x07,0x80,0x00,0x07,0xE8,0x02,0x00,0x63,0x1C,0xFC,0x00,
+            0x02,0x0E,0x54,0x98,0xF8,0x00,0x00,0xC0,0xFC,0x00,0x01,0x33,0x5C,0xFC,0x00,0x02,
+            0x0E,0x92,0xA8,0xF8,0x00,0x00,0x80,0xFC,0x00,0x01,0x19,0x5C,0xFC,0x00,0x02,0x0E,
+            0xAA,0x58,0xF8,0x00,0x00,0xC0,0xFC,0x00,0x01,0x09,0xAC,0xFC,0x00,0x02,0x0E,0x49,
+            0x28,0xFC,0x00,0x00,0x16,0xFE,0x00,0x00,0x80,0xFC,0x00,0x01,0x0D,0x9C,0xFC,0x00,
+            0x02,0x0E,0xA5,0x50,0xFD,0x00,0x01,0x01,0x7C,0xFE,0x00,0x00,0xC0,0xFC,0x00,0x01,
+            0x05,0xAC,0xFC,0x00,0x02,0x0E,0x54,0xB0,0xFD,0x00,0x01,0x2F,0x80,0xFE,0x00,0x02,
+            0x80,0x00,0x07,0xFE,0x00,0x01,0x04,0xAC,0xFC,0x00,0x02,0x0E,0x92,0x50,0xFE,0x00,
+            0x01,0x02,0xF8,0xFD,0x00,0x07,0xC0,0x00,0x01,0xE8,0x00,0x00,0x04,0xDC,0xFC,0x00,
+            0x06,0x0E,0x4A,0xB0,0x00,0x02,0x00,0x2F,0xFC,0x00,0x07,0x80,0x00,0x00,0x3E,0x00,
+            0x00,0x04,0xDC,0xFC,0x00,0x06,0x0E,0xA9,0x50,0x00,0x07,0xFA,0xF8,0xFC,0x00,0x07,
+            0xC0,0x00,0x00,0x07,0xC0,0x00,0x04,0xDC,0xFC,0x00,0x06,0x0E,0x54,0xB0,0x00,0x0F,
+            0xFF,0xF4,0xFC,0x00,0x00,0x40,0xFE,0x00,0x03,0xB8,0x00,0x04,0xCC,0xFC,0x00,0x07,
+            0x0E,0x92,0x60,0x00,0x07,0xFF,0xFF,0xE8,0xFD,0x00,0x00,0xC0,0xFE,0x00,0x03,0x0F,
+            0x80,0x04,0xDC,0xFC,0x00,0x04,0x0E,0x4A,0xB0,0x00,0x1F,0xFE,0xFF,0x00,0xC0,0xFE,
+            0x00,0x00,0x40,0xFE,0x00,0x03,0x01,0xF0,0x0C,0x5C,0xFC,0x00,0x03,0x0E,0xA9,0x60,
+            0x01,0xFD,0xFF,0x04,0xFE,0x80,0x00,0x00,0xC0,0xFD,0x00,0x02,0x2E,0x08,0xDC,0xFC,
+            0x00,0x04,0x06,0x54,0xA0,0x01,0x8F,0xFD,0xFF,0x03,0xFC,0x00,0x00,0x40,0xFD,0x00,
+            0x02,0x07,0xC8,0x5C,0xFC,0x00,0x04,0x0F,0x25,0x60,0x00,0x0F,0xFC,0xFF,0x02,0xF0,
+            0x00,0xC0,0xFC,0x00,0x01,0x7C,0x6C,0xFC,0x00,0x04,0x06,0x94,0xA0,0x00,0x0F,0xFB,
+            0xFF,0x01,0xA0,0x40,0xFC,0x00,0x01,0x1E,0x58,0xFC,0x00,0x04,0x06,0xA5,0x60,0x00,
+            0x07,0xFA,0xFF,0x00,0xC0,0xFC,0x00,0x01,0x30,0x78,0xFC,0x00,0x06,0x07,0x52,0x60,
+            0x00,0x0F,0xFF,0xEF,0xFC,0xFF,0x00,0xFA,0xFC,0x00,0x01,0x20,0x58,0xFC,0x00,0x04,
+            0x07,0x29,0x20,0x00,0x07,0xF9,0xFF,0x00,0xE8,0xFD,0x00,0x01,0x60,0x78,0xFC,0x00,
+            0x07,0x07,0x4A,0xB0,0x00,0x07,0xFF,0xFF,0xFD,0xFB,0xFF,0x05,0xA0,0x00,0x00,0x01,
+            0xC0,0x78,0xFC,0x00,0x07,0x03,0x25,0x60,0x00,0x07,0xFF,0xFF,0xBF,0xFA,0xFF,0x04,
+            0x40,0x00,0x07,0x00,0x70,0xFC,0x00,0x04,0x07,0xA9,0x30,0x00,0x07,0xFD,0xFF,0x00,
+            0x7F,0xFB,0xFF,0x03,0xAA,0xFC,0x00,0xD0,0xFC,0x00,0x05,0x03,0x54,0xA0,0x00,0x07,
+            0xF7,0xFD,0xFF,0x00,0x7F,0xFB,0xFF,0x02,0xC0,0x00,0x70,0xFC,0x00,0x04,0x03,0x92,
+            0xB0,0x00,0x03,0xFB,0xFF,0x00,0xFE,0xFC,0xFF,0x02,0x80,0x00,0xE0,0xFC,0x00,0x09,
+            0x03,0xAA,0x50,0x00,0x03,0xFF,0xFF,0xFE,0xA2,0xAB,0xFA,0xFF,0x02,0x00,0x00,0x60,
+            0xFC,0x00,0x0A,0x01,0x92,0xB0,0x00,0x03,0xFF,0xFF,0xEA,0xBA,0xAD,0x7F,0xFC,0xFF,
+            0x03,0xFE,0x00,0x00,0xE0,0xFC,0x00,0x13,0x01,0xC9,0x50,0x00,0x01,0xFF,0xDF,0x55,
+            0x4A,0xB5,0x57,0xFF,0xFF,0xBF,0xFF,0xFF,0xFE,0x00,0x00,0xE0,0xFC,0x00,0x0C,0x01,
+            0xD4,0xB0,0x00,0x01,0xFF,0xFD,0x55,0xB5,0x55,0x55,0xFF,0xFE,0xFE,0xFF,0x03,0xFC,
+            0x00,0x00,0xE0,0xFC,0x00,0x13,0x01,0xCA,0x58,0x00,0x01,0xFF,0xFA,0xDA,0xAB,0x56,
+            0xAA,0xBF,0xFF,0xFF,0x7F,0xFF,0xF8,0x00,0x00,0xE0,0xFB,0x00,0x0A,0xE5,0x28,0x00,
+            0x00,0xFD,0xEB,0x55,0x55,0x6A,0xDA,0xDF,0xFD,0xFF,0x03,0xF8,0x00,0x00,0xC0,0xFB,
+            0x00,0x06,0xD2,0x98,0x00,0x00,0xFF,0xD5,0x56,0xFE,0xAA,0x01,0xAF,0xEF,0xFE,0xFF,
+            0x03,0xB0,0x00,0x00,0xC0,0xFB,0x00,0x0A,0xE9,0x58,0x00,0x00,0xFF,0xAA,0xAA,0xDB,
+            0x55,0x55,0x53,0xFD,0xFF,0x03,0xF0,0x00,0x01,0xC0,0xFB,0x00,0x0A,0x6A,0x8C,0x00,
+            0x00,0x7F,0x5A,0xD5,0x55,0x5B,0x5B,0x6D,0xFD,0xFF,0x04,0xE0,0x00,0x01,0xC1,0x54,
+            0xFC,0x00,0x06,0x74,0xAC,0x00,0x00,0x7D,0x6B,0x5A,0xFD,0xAA,0x00,0x7F,0xFE,0xFF,
+            0x05,0xC0,0x00,0x01,0x8F,0xFF,0xC0,0xFD,0x00,0x04,0x72,0x54,0x00,0x00,0x3D,0xFB,
+            0x55,0x09,0xBF,0xF7,0xFF,0xBF,0xC0,0x00,0x03,0x9F,0xDF,0xF0,0xFD,0x00,0x14,0x39,
+            0x4E,0x00,0x00,0x3B,0x5A,0xAB,0x6B,0x6A,0xAA,0xAA,0xAF,0xFF,0xDF,0xFF,0x80,0x00,
+            0x03,0xFC,0x00,0xF8,0xFD,0x00,0x0B,0x3A,0xA6,0x00,0x00,0x1A,0xAA,0xD5,0x55,0x56,
+            0xDB,0x6D,0x5F,0xFE,0xFF,0x05,0x00,0x00,0x07,0xF0,0x00,0x3C,0xFD,0x00,0x06,0x1A,
+            0x56,0x00,0x00,0x1A,0xD5,0x5A,0xFD,0xAA,0x09,0xAF,0xFF,0xFF,0xFE,0x00,0x00,0x07,
+            0xE0,0x00,0x1E,0xFD,0x00,0x07,0x1D,0x2B,0x00,0x00,0x0D,0x5A,0xAA,0xD5,0xFE,0x55,
+            0x09,0xAB,0xFF,0xFF,0xFE,0x00,0x00,0x0F,0xC0,0x00,0x07,0xFD,0x00,0x15,0x1C,0x95,
+            0x00,0x00,0x0E,0xAB,0x55,0x5B,0x6A,0xAA,0xAA,0xB5,0xFF,0xFF,0xFC,0x00,0x00,0x0F,
+            0x80,0x00,0x07,0x80,0xFE,0x00,0x15,0x0E,0xA3,0x00,0x00,0x06,0xD5,0x6A,0xAA,0xAD,
+            0xB5,0xB5,0x55,0xFF,0xFF,0xD8,0x00,0x00,0x0F,0x00,0x00,0x03,0x80,0xFE,0x00,0x15,
+            0x0E,0x55,0x80,0x00,0x03,0x5A,0xAD,0x55,0x55,0x56,0xAB,0x5A,0xFE,0xFE,0xF0,0x00,
+            0x00,0x1F,0x00,0x00,0x01,0xC0,0xFE,0x00,0x06,0x07,0x2A,0x80,0x00,0x03,0x6B,0x55,
+            0xFE,0xAA,0x0B,0xAD,0x6B,0x7F,0xFF,0xF0,0x00,0x00,0x3E,0x00,0x00,0x01,0xC0,0xFE,
+            0x00,0x08,0x07,0x49,0xC0,0x00,0x01,0xAA,0xAA,0xB5,0xB5,0xFE,0x55,0x05,0x7F,0xFF,
+            0xE0,0x00,0x00,0x3C,0xFE,0x00,0x00,0xE0,0xFE,0x00,0x11,0x03,0xA4,0xC0,0x00,0x00,
+            0xD5,0x5A,0xAA,0xAB,0x6A,0xAA,0xAA,0xBF,0xFF,0xC0,0x00,0x00,0x7C,0xFE,0x00,0x00,
+            0xE0,0xFE,0x00,0x11,0x03,0xAA,0x60,0x00,0x00,0xED,0xAA,0xAD,0x55,0x56,0xD5,0x56,
+            0xFF,0xFF,0x80,0x00,0x00,0x7C,0xFE,0x00,0x00,0x60,0xFE,0x00,0x0D,0x01,0xD2,0xA0,
+            0x00,0x00,0x75,0x55,0xB5,0x6A,0xAA,0xAD,0xB5,0x5F,0xF7,0xFE,0x00,0x00,0xFC,0xFE,
+            0x00,0x00,0x60,0xFD,0x00,0x07,0xC9,0x70,0x00,0x00,0x35,0x6A,0xAA,0xAD,0xFE,0x55,
+            0x01,0x5F,0xFE,0xFE,0x00,0x00,0xF8,0xFE,0x00,0x00,0x70,0xFD,0x00,0x07,0xF4,0xB0,
+            0x00,0x00,0x1A,0xAD,0x55,0x55,0xFE,0xAA,0x05,0xBF,0xFC,0x00,0x00,0x01,0xDC,0xFE,
+            0x00,0x00,0x70,0xFD,0x00,0x10,0x72,0x58,0x00,0x00,0x0E,0xD5,0x56,0xAA,0xB6,0xD5,
+            0x56,0xDF,0xF8,0x00,0x00,0x03,0x98,0xFE,0x00,0x00,0x70,0xFD,0x00,0x10,0x7A,0xA8,
+            0x00,0x00,0x07,0x55,0xAA,0xD5,0x55,0x5B,0x6A,0xAF,0xF0,0x00,0x00,0x03,0x18,0xFE,
+            0x00,0x00,0x70,0xFD,0x00,0x07,0x39,0x2C,0x00,0x00,0x03,0x5A,0xB5,0x5A,0xFE,0xAA,
+            0x05,0xBF,0xE0,0x00,0x00,0x07,0x1C,0xFE,0x00,0x00,0x60,0xFD,0x00,0x07,0x1C,0xAC,
+            0x00,0x00,0x01,0xD5,0x56,0xAB,0xFE,0x55,0x05,0x4F,0xC0,0x00,0x00,0x0E,0x1C,0xFE,
+            0x00,0x00,0x60,0xFD,0x00,0x01,0x1E,0x96,0xFE,0x00,0x0B,0xEA,0xAA,0xD5,0x6D,0xAA,
+            0xAD,0xBF,0x80,0x00,0x00,0x1C,0x3C,0xFE,0x00,0x00,0xE0,0xFD,0x00,0x01,0x0E,0x4B,
+            0xFE,0x00,0x06,0x75,0xB5,0x55,0x55,0x5B,0x6A,0xAF,0xFE,0x00,0x01,0x1C,0xFC,0xFE,
+            0x00,0x00,0xC0,0xFD,0x00,0x01,0x07,0x55,0xFE,0x00,0x01,0x1D,0x56,0xFD,0xAA,0x00,
+            0xD6,0xFE,0x00,0x01,0x3F,0xE6,0xFE,0x00,0x00,0xC0,0xFD,0x00,0x07,0x03,0xA5,0x80,
+            0x00,0x00,0x0E,0xAA,0xDB,0xFE,0x55,0x00,0x58,0xFE,0x00,0x05,0x7F,0xD6,0x00,0x00,
+            0x01,0xC0,0xFD,0x00,0x0B,0x03,0xD2,0xC0,0x00,0x00,0x07,0xB5,0x55,0x6B,0x6A,0xB6,
+            0xF0,0xFE,0x00,0x05,0xFF,0x2B,0x00,0x00,0x01,0x80,0xFD,0x00,0x13,0x01,0xD5,0x40,
+            0x00,0x00,0x01,0xD6,0xAA,0xAD,0x56,0xD5,0xC0,0x00,0x00,0x01,0xFE,0xA5,0x00,0x00,
+            0x03,0xFB,0x00,0x01,0xE9,0x60,0xFE,0x00,0x0D,0x75,0x55,0x55,0x5A,0xAB,0x80,0x00,
+            0x00,0x03,0xF9,0x53,0x80,0x00,0x07,0xFB,0x00,0x01,0x75,0x70,0xFE,0x00,0x04,0x3E,
+            0xB6,0xAA,0xAA,0xBE,0xFE,0x00,0x05,0x07,0xF4,0x94,0xC0,0x00,0x0E,0xFB,0x00,0x01,
+            0x3A,0x30,0xFE,0x00,0x04,0x0B,0xD5,0x6D,0xAA,0xF8,0xFE,0x00,0x05,0x0F,0xCA,0xAA,
+            0xE0,0x00,0x1C,0xFB,0x00,0x01,0x1D,0x58,0xFE,0x00,0x04,0x02,0xEA,0xAA,0xAF,0xC0,
+            0xFE,0x00,0x05,0x1F,0xA4,0x92,0x38,0x00,0x3C,0xFB,0x00,0x01,0x0F,0x2C,0xFD,0x00,
+            0x03,0x7F,0x55,0x7E,0x80,0xFE,0x00,0x05,0x3E,0x55,0x49,0x5E,0x01,0xF0,0xFB,0x00,
+            0x01,0x07,0x96,0xFD,0x00,0x02,0x0B,0xFF,0xF0,0xFD,0x00,0x05,0x7D,0x2A,0x55,0x47,
+            0xFF,0xC0,0xFB,0x00,0x01,0x03,0xCB,0xFC,0x00,0x00,0x54,0xFD,0x00,0x05,0x01,0xF4,
+            0x91,0x24,0xA9,0x7F,0xFA,0x00,0x01,0x01,0xEB,0xF7,0x00,0x05,0x03,0xEA,0xAA,0x92,
+            0x55,0x38,0xF9,0x00,0x01,0xF5,0xC0,0xF9,0x00,0x06,0x04,0x97,0xD5,0x49,0x55,0x24,
+            0xF0,0xF9,0x00,0x06,0x7F,0xFF,0xFF,0xED,0x55,0x55,0x57,0xFC,0xFF,0x04,0x49,0x24,
+            0xA9,0x52,0x60,0xF9,0x00,0x00,0x3F,0xF7,0xFF,0x05,0xFE,0xA4,0xAA,0x45,0x2A,0xE0,
+            0xF9,0x00,0x00,0x7F,0xF7,0xFF,0x05,0xFD,0x2A,0x92,0xAA,0x95,0xC0,0xF9,0x00,0x00,
+            0x7F,0xF7,0xFF,0x05,0xFE,0xA5,0x49,0x24,0xA5,0xC0,0xF9,0x00,0x00,0x7F,0xF7,0xFF,
+            0x05,0xFD,0x28,0xAA,0x92,0x93,0x80,0xF9,0x00,0x00,0x7F,0xF7,0xFF,0x05,0xFD,0x4A,
+            0x49,0x55,0x55,0x80,0xF9,0x00,0xFA,0xFF,0x08,0xFA,0x0F,0xFF,0xFF,0xFD,0x25,0x24,
+            0x92,0x4B,0xF9,0x00,0x00,0x01,0xFA,0xFF,0x08,0xF0,0x23,0xFF,0xFD,0xAD,0x52,0xAA,
+            0x49,0x2E,0xF9,0x00,0x10,0x03,0xC5,0x55,0x56,0xDB,0xEA,0xDF,0xFF,0xC2,0x81,0x80,
+            0x1A,0x56,0xA9,0x25,0x55,0x56,0xF9,0x00,0x10,0x07,0x54,0xAA,0xA9,0x2B,0x80,0x00,
+            0x00,0xDA,0xFC,0xC0,0x0E,0xAA,0x4A,0x92,0x4A,0x9C,0xF9,0x00,0x10,0x1F,0x52,0x92,
+            0x55,0x56,0x00,0x00,0x01,0xFF,0x57,0xE0,0x03,0x27,0x29,0x55,0x24,0xBC,0xF9,0x00,
+            0x10,0x1C,0x8A,0x49,0x24,0x96,0x00,0x00,0x01,0xC0,0x00,0xF0,0x01,0xAB,0x4A,0x49,
+            0x52,0x78,0xF9,0x00,0x10,0x7A,0x52,0xAA,0x92,0x5C,0x00,0x00,0x07,0x02,0xB4,0x18,
+            0x3F,0xD5,0x25,0x24,0x95,0x70,0xF9,0x00,0x10,0x75,0x49,0x24,0xAA,0xB0,0x00,0x00,
+            0x04,0x5F,0xFF,0xD8,0xFD,0xE7,0xA9,0x55,0x52,0xE0,0xF9,0x00,0x10,0xE9,0x2A,0x92,
+            0x95,0x50,0x00,0x00,0x06,0xF4,0x01,0x79,0xD6,0xB3,0x25,0x24,0xA9,0xE0,0xFA,0x00,
+            0x11,0x01,0xD4,0xA4,0xAA,0x49,0x60,0x00,0x00,0x07,0x80,0x50,0x1B,0xBB,0xD9,0x94,
+            0x92,0x57,0xC0,0xFA,0x00,0x11,0x03,0xCA,0x92,0x92,0xA4,0xC0,0x00,0x00,0x06,0x12,
+            0x79,0x13,0xC0,0x6D,0xAA,0x55,0x27,0x80,0xFA,0x00,0x10,0x07,0x25,0x55,0x49,0x2A,
+            0xC0,0x00,0x00,0x02,0x00,0xFC,0x5E,0xAA,0x3E,0xA5,0x49,0x57,0xF9,0x00,0x10,0x07,
+            0x52,0x48,0xAA,0x95,0x80,0x00,0x00,0x06,0x49,0xCC,0x1F,0x9F,0x97,0x92,0x54,0x9E,
+            0xF9,0x00,0x04,0x0E,0x95,0x25,0x24,0xA3,0xFE,0x00,0x08,0x02,0x00,0xF9,0x1A,0xB5,
+            0xDB,0xD5,0x25,0x5E,0xF9,0x00,0x04,0x1D,0x52,0xAA,0x92,0x55,0xFE,0x00,0x08,0x03,
+            0x24,0x78,0x3F,0x20,0x8F,0xA9,0x52,0x78,0xF9,0x00,0x04,0x3C,0x94,0x92,0x55,0x2A,
+            0xFE,0x00,0x08,0x02,0x00,0x22,0x1A,0x70,0xEB,0xCA,0xAA,0xF8,0xF9,0x00,0x04,0x35,
+            0x4A,0x49,0x49,0x4E,0xFE,0x00,0x08,0x01,0x92,0x30,0xBF,0x5F,0x6D,0xD4,0x95,0x60,
+            0xF9,0x00,0x04,0x74,0xA5,0x55,0x25,0x24,0xFE,0x00,0x08,0x01,0x80,0xA4,0x6D,0x75,
+            0xCC,0xCA,0x4B,0xE0,0xF9,0x00,0x04,0xF2,0x52,0x49,0x54,0xAC,0xFD,0x00,0x07,0xC8,
+            0x30,0xCF,0x20,0xEA,0xD2,0xA7,0x80,0xF9,0x00,0x04,0xEA,0x95,0x24,0x92,0x98,0xFD,
+            0x00,0x06,0xC2,0x21,0x8D,0x70,0x8E,0x69,0x2F,0xF9,0x00,0x05,0x01,0xD5,0x49,0x55,
+            0x4A,0x58,0xFD,0x00,0x06,0x70,0x6B,0x0F,0x3D,0xD4,0x54,0xAE,0xF9,0x00,0x05,0x01,
+            0xC9,0x24,0x92,0x55,0x58,0xFD,0x00,0x06,0x1C,0x26,0x0A,0x97,0x1C,0x65,0x5C,0xF9,
+            0x00,0x05,0x03,0xA4,0xAA,0x49,0x22,0xA8,0xFD,0x00,0x06,0x0F,0xFC,0x07,0xCA,0x6C,
+            0x6A,0xB8,0xF9,0x00,0x05,0x03,0x55,0x52,0xAA,0x94,0xB0,0xFD,0x00,0x06,0x01,0xD0,
+            0x07,0x60,0x58,0x65,0xF0,0xF9,0x00,0x05,0x07,0x49,0x29,0x24,0xAA,0x50,0xFB,0x00,
+            0x04,0x03,0xBF,0xF0,0x53,0xE0,0xF9,0x00,0x05,0x07,0x24,0x94,0x92,0x49,0x30,0xFB,
+            0x00,0x04,0x01,0xD5,0x60,0x6F,0x80,0xF9,0x00,0x05,0x0E,0x95,0x4A,0xAA,0xA5,0x60,
+            0xFA,0x00,0x02,0xFF,0xC0,0x2F,0xF8,0x00,0x05,0x0D,0x52,0x52,0x49,0x2A,0xB0,0xFA,
+            0x00,0x02,0x2D,0x00,0x7E,0xF8,0x00,0x05,0x1D,0x29,0x49,0x24,0x92,0x60,0xF8,0x00,
+            0x00,0x3C,0xF8,0x00,0x05,0x1C,0xA5,0x2A,0xAA,0xA9,0x60,0xF8,0x00,0x00,0x30,0xF8,
+            0x00,0x05,0x1A,0x94,0xA4,0x92,0x4A,0x60,0xF8,0x00,0x00,0x30,0xF8,0x00,0x08,0x7D,
+            0x52,0x92,0x49,0x29,0x60,0x00,0x15,0x7F,0xFC,0xFF,0x01,0xD4,0x30,0xF9,0x00,0x02,
+            0x01,0xFF,0xD4,0xFE,0xAA,0x0A,0x40,0x03,0xFF,0xD5,0x24,0x40,0x00,0x92,0x55,0x7E,
+            0x30,0xF9,0x00,0x08,0x07,0xC0,0x7A,0x49,0x24,0xB9,0x60,0x06,0x80,0xFB,0x00,0x01,
+            0x02,0x30,0xF9,0x00,0x07,0x0F,0x00,0x0D,0x24,0x92,0x65,0x60,0x04,0xFA,0x00,0x01,
+            0x02,0x30,0xF9,0x00,0x07,0x1C,0x00,0x07,0x55,0x55,0xEA,0x40,0x06,0xFA,0x00,0x01,
+            0x02,0x30,0xF9,0x00,0x07,0x38,0x00,0x01,0x92,0x4A,0x91,0x60,0x02,0xFA,0x00,0x01,
+            0x02,0x38,0xF9,0x00,0x07,0x70,0x00,0x00,0xD5,0x57,0xD5,0x60,0x06,0xFA,0x00,0x01,
+            0x06,0x30,0xF6,0x00,0x00,0x40,0xF5,0x00,0x00,0x10,0xFB,0x00};
+
+#endif /* IMAGES_H_ */
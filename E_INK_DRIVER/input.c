@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: input.c
+//                  Button input and application events
+//                          Author: Sonikku
+//
+//              S2 (P1.3) interrupts on an edge instead of being polled. The edge interrupt is switched off at once and
+//              a one-shot compare on Timer0_A CCR2 is armed INPUT_DEBOUNCE_MS ahead; when it fires the pin is sampled,
+//              a press or release event is posted if the level changed, and the edge interrupt is armed again for the
+//              opposite edge. Bounces inside the window are never seen, and nothing runs while the button is left alone.
+//
+//              The debounced level needs no RAM of its own: between windows P1IES always selects the edge that leaves
+//              it. Events are taken by the task scheduler (sched.c), which sleeps until something is posted or another
+//              interrupt wakes the CPU. With PROFILING, the PROF_INPUT scope is opened on the press edge so the
+//              application can close it when it acts on the press, giving the press to action latency.
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "input.h"
+#include "timer.h"
+#include "profile.h"
+
+#define S2 BIT3                 // P1.3, LOW when pressed
+
+volatile unsigned char pending_events;          // Posted, not yet taken by TakeEvents
+
+
+//------------------------------------------------------------------------
+// Name: InitInput
+// Function: S2 as input with pull up, interrupt on the press (falling) edge
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void InitInput(void){
+    pending_events = 0;
+
+    P1DIR &= ~S2;
+    P1OUT |= S2;                                // Pull up
+    P1REN |= S2;
+    P1IES |= S2;                                // HIGH -> LOW
+    P1IFG &= ~S2;
+    P1IE |= S2;
+}
+
+//------------------------------------------------------------------------
+// Name: PostEvent
+// Function: Post events for the tasks (also from interrupt context)
+// Arguments: Event bits (EVENT_...)
+// Returns: void
+//------------------------------------------------------------------------
+void PostEvent(unsigned char events){
+    pending_events |= events;                   // A single BIS.B, no need to mask interrupts
+}
+
+//------------------------------------------------------------------------
+// Name: TakeEvents
+// Function: Take all posted events
+// Arguments: void
+// Returns: Event bits (EVENT_...)
+//------------------------------------------------------------------------
+unsigned char TakeEvents(void){
+    unsigned short state;
+    unsigned char events;
+
+    state = __get_interrupt_state();
+    __disable_interrupt();
+    events = pending_events;
+    pending_events = 0;
+    __set_interrupt_state(state);
+
+    return events;
+}
+
+//------------------------------------------------------------------------
+// Name: ButtonDown
+// Function: Debounced state of S2
+// Arguments: void
+// Returns: 1 = pressed, 0 = released
+//------------------------------------------------------------------------
+unsigned char ButtonDown(void){
+    return (P1IES & S2) == 0;                   // Waiting for the release edge
+}
+
+//------------------------------------------------------------------------
+// Name: CallInInputISR
+// Function: Call this in the PORT1 ISR. Takes the S2 edge and starts the debounce window
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void CallInInputISR(void){
+    unsigned int ticks;
+
+    if ((P1IFG & P1IE & S2) != 0){
+        P1IE &= ~S2;                            // Bounces are ignored until the window closes
+        P1IFG &= ~S2;
+        if ((P1IES & S2) != 0){
+            PROFILE_BEGIN(PROF_INPUT);          // Press edge
+        }
+        ticks = (unsigned int)(((unsigned long)INPUT_DEBOUNCE_MS * TimerRate()) >> 6) + 2;
+        TA0CCR2 = TimerTicks() + ticks;
+        TA0CCTL2 = CCIE;                        // Clear CCIFG, enable compare interrupt
+    }
+}
+
+//------------------------------------------------------------------------
+// Name: CallInDebounceISR
+// Function: Call this in the Timer0_A TA0IV ISR for CCR2. Samples S2 once the debounce window has closed
+// Arguments: void
+// Returns: 1 if an event was posted and the CPU must leave LPM3, else 0
+//------------------------------------------------------------------------
+unsigned char CallInDebounceISR(void){
+    unsigned char down;
+    unsigned char was_down;
+
+    TA0CCTL2 = 0;                               // One-shot
+    was_down = ButtonDown();
+    down = ((P1IN & S2) == 0) ? 1 : 0;
+
+    // Arm the edge that leaves the sampled level. Changing P1IES may set P1IFG, so clear it, and catch a change
+    // that came in meanwhile by setting the flag by hand
+    if (down != 0){
+        P1IES &= ~S2;                           // Release: LOW -> HIGH
+    } else {
+        P1IES |= S2;                            // Press: HIGH -> LOW
+    }
+    P1IFG &= ~S2;
+    if ((((P1IN & S2) == 0) ? 1 : 0) != down){
+        P1IFG |= S2;
+    }
+    P1IE |= S2;
+
+    if (down == was_down){
+        return 0;                               // Only a glitch
+    }
+    if (down != 0){
+        pending_events |= EVENT_S2_PRESS;
+    } else {
+        pending_events |= EVENT_S2_RELEASE;
+    }
+    return 1;
+}
@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for input.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef INPUT_H_
+#define INPUT_H_
+
+// Definitions
+//--------------------
+#define INPUT_DEBOUNCE_MS   20                  // S2 must be stable this long before a press or release counts
+
+// Events (bit mask, see TakeEvents)
+#define EVENT_S2_PRESS      0x01
+#define EVENT_S2_RELEASE    0x02
+#define EVENT_TIMER         0x04                // Timer0_A CCR1 compare (Delay / TimerWait deadline), posted by main.c
+#define EVENT_SHOW_NEXT     0x08                // Posted by the application (main.c)
+#define EVENT_FRAME_DONE    0x10                // Refresh over (BUSY edge), posted by main.c
+#define EVENT_TX_IDLE       0x20                // USCI_B0 transport has loaded its last byte, posted by main.c
+
+// Function Prototypes
+//--------------------
+void InitInput(void);
+void PostEvent(unsigned char events);
+unsigned char TakeEvents(void);
+unsigned char ButtonDown(void);
+void CallInInputISR(void);
+unsigned char CallInDebounceISR(void);
+
+#endif /* INPUT_H_ */
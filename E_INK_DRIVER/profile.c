@@ -0,0 +1,204 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: profile.c
+//                  On-target profiling of driver phases
+//                          Author: Sonikku
+//
+//              Timer1_A runs from SMCLK in continuous mode and its overflows are counted, giving a 32 bit time stamp
+//              of one tick per SMCLK cycle (0.5 us: SMCLK is 2 MHz whichever MCLK is in use, see clock.h). The
+//              timer.c timebase ticks at ~1.5 kHz, far too coarse for this. One scope is timed per build
+//              (PROFILE_SCOPE): the timer is restarted when it opens, so only its total ticks and call count take
+//              RAM; ProfileDump() prints them over the LaunchPad backchannel UART.
+//
+//              The backchannel TXD is P1.2, which is also the panel RESET. ProfileDump() borrows the pin as UCA0TXD
+//              for the dump, so the panel is reset by the data: call InitDisplay() afterwards.
+//
+//              Everything here is only built with PROFILING defined (profile.h)
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "profile.h"
+#include "clock.h"
+
+#ifdef PROFILING
+
+#define UART_TXD BIT2           // P1.2 as UCA0TXD (shared with the panel RESET)
+
+// PROFILE_SCOPE totals
+//------------------
+unsigned long scope_total;                      // Ticks spent in the scope
+unsigned int scope_count;                       // Calls
+volatile unsigned int timer1_overflows;         // High word of the time since the scope opened
+
+const char * const scope_name[PROFILE_SCOPES] ={
+    "INIT", "UPLOAD", "BUSY", "TEXT", "INPUT"
+};
+
+
+//------------------------------------------------------------------------
+// Name: ProfileTime
+// Function: 32 bit time since ProfileBegin (Timer1_A overflows : TA1R)
+//           Also right while interrupts are off and an overflow is still pending
+// Arguments: void
+// Returns: Ticks
+//------------------------------------------------------------------------
+static unsigned long ProfileTime(void){
+    unsigned short state;
+    unsigned int high;
+    unsigned int low;
+
+    state = __get_interrupt_state();
+    __disable_interrupt();
+    high = timer1_overflows;
+    low = TA1R;
+    if (((TA1CTL & TAIFG) != 0) && (low < 0x8000)){
+        high++;                                 // Wrapped, ISR not run yet
+    }
+    __set_interrupt_state(state);
+
+    return ((unsigned long)high << 16) | low;
+}
+
+//------------------------------------------------------------------------
+// Name: UartSend
+// Function: Send a string on UCA0 (polled)
+// Arguments: String
+// Returns: void
+//------------------------------------------------------------------------
+static void UartSend(const char *text){
+
+    while (*text != 0){
+        while ((IFG2 & UCA0TXIFG) == 0){
+            ;
+        }
+        UCA0TXBUF = *text++;
+    }
+}
+
+//------------------------------------------------------------------------
+// Name: UartNumber
+// Function: Send an unsigned number in decimal
+// Arguments: Number
+// Returns: void
+//------------------------------------------------------------------------
+static void UartNumber(unsigned long n){
+    char digits[11];
+    unsigned char i = 10;
+
+    digits[10] = 0;
+    do {
+        digits[--i] = '0' + (n % 10);
+        n = n / 10;
+    } while (n != 0);
+    UartSend(&digits[i]);
+}
+
+#endif
+
+
+//------------------------------------------------------------------------
+// Name: InitProfiler
+// Function: Start the Timer1_A time base and clear the table
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void InitProfiler(void){
+#ifdef PROFILING
+    timer1_overflows = 0;
+    TA1CTL = TASSEL_2 | ID_0 | MC_2 | TACLR | TAIE;    // SMCLK / 1, continuous, overflow interrupt
+    ProfileReset();
+#endif
+}
+
+//------------------------------------------------------------------------
+// Name: ProfileReset
+// Function: Clear the scope table
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void ProfileReset(void){
+#ifdef PROFILING
+    scope_total = 0;
+    scope_count = 0;
+#endif
+}
+
+//------------------------------------------------------------------------
+// Name: ProfileBegin / ProfileEnd
+// Function: Open and close PROFILE_SCOPE (use the PROFILE_BEGIN / PROFILE_END macros, which pick the scope
+//           and vanish without PROFILING)
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void ProfileBegin(void){
+#ifdef PROFILING
+    unsigned short state;
+
+    state = __get_interrupt_state();
+    __disable_interrupt();
+    TA1CTL |= TACLR;                            // Time from 0, so no start time has to be kept
+    TA1CTL &= ~TAIFG;
+    timer1_overflows = 0;
+    __set_interrupt_state(state);
+#endif
+}
+
+void ProfileEnd(void){
+#ifdef PROFILING
+    scope_total += ProfileTime();
+    scope_count++;
+#endif
+}
+
+//------------------------------------------------------------------------
+// Name: ProfileDump
+// Function: Print PROFILE_SCOPE on the backchannel UART: <name> <calls> <ticks>,
+//           after a header giving the tick rate
+//           P1.2 is the panel RESET - call InitDisplay() afterwards
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void ProfileDump(void){
+#ifdef PROFILING
+    UCA0CTL1 = UCSWRST;
+    UCA0CTL1 |= UCSSEL_2;                                       // SMCLK
+    UCA0BR0 = (CLOCK_SMCLK_HZ / PROFILE_BAUD) & 0xFF;
+    UCA0BR1 = (CLOCK_SMCLK_HZ / PROFILE_BAUD) >> 8;
+    UCA0MCTL = UCBRS_3;                                         // 2 MHz / 9600 = 208.33, 0.33 x 8 = 3
+    P1SEL |= UART_TXD;
+    P1SEL2 |= UART_TXD;
+    UCA0CTL1 &= ~UCSWRST;
+
+    UartSend("PROFILE ticks/s ");
+    UartNumber(CLOCK_SMCLK_HZ);
+    UartSend("\r\n");
+    UartSend(scope_name[PROFILE_SCOPE]);
+    UartSend(" ");
+    UartNumber(scope_count);
+    UartSend(" ");
+    UartNumber(scope_total);
+    UartSend("\r\n");
+
+    while ((UCA0STAT & UCBUSY) != 0){
+        ;
+    }
+    UCA0CTL1 = UCSWRST;
+    P1SEL &= ~UART_TXD;                                         // Back to the RESET output (HIGH = inactive)
+    P1SEL2 &= ~UART_TXD;
+    P1OUT |= UART_TXD;
+#endif
+}
+
+//------------------------------------------------------------------------
+// Name: CallInProfilerISR
+// Function: Call this in the Timer1_A TA1IV ISR
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void CallInProfilerISR(void){
+#ifdef PROFILING
+    if (TA1IV == TA1IV_TAIFG){                  // Reading TA1IV clears the flag
+        timer1_overflows++;
+    }
+#endif
+}
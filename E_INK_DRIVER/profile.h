@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for profile.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+// Build switch
+//--------------------
+//#define PROFILING                             // Time a driver phase with Timer1_A and dump it over the UART (ProfileDump)
+                                                // Costs 8 bytes RAM (GPIO transport: 511 of 512 bytes with the stack,
+                                                // too much for USCI_B0), and the driver sleeps in LPM0 instead of LPM3
+                                                // so SMCLK (and the timer) keep running
+#define PROFILE_SCOPE       PROF_UPLOAD         // The one scope timed in a build (RAM has room for one set of totals)
+
+#define PROFILE_BAUD        9600UL              // Backchannel UART
+
+// Scopes
+//--------------------
+#define PROF_INIT           0                   // InitDisplay
+#define PROF_UPLOAD         1                   // Loading display RAM (LoadBitmap, LoadText, LoadBand, RenderDisplayList ...)
+#define PROF_BUSY           2                   // Waiting for BUSY (refresh time)
+#define PROF_TEXT           3                   // Text rendering into frame_buffer (OutString, BlitString)
+#define PROF_INPUT          4                   // Button press edge to the main loop acting on it
+#define PROFILE_SCOPES      5
+
+// Scopes other than PROFILE_SCOPE compile to nothing. Times are inclusive (an upload includes its BUSY waits)
+#ifdef PROFILING
+#define PROFILE_BEGIN(scope)    {if ((scope) == PROFILE_SCOPE){ ProfileBegin(); }}
+#define PROFILE_END(scope)      {if ((scope) == PROFILE_SCOPE){ ProfileEnd(); }}
+#else
+#define PROFILE_BEGIN(scope)
+#define PROFILE_END(scope)
+#endif
+
+// Sleep mode for WaitBusy, Delay and the task scheduler
+#ifdef PROFILING
+#define IDLE_LPM_BITS       LPM0_bits
+#else
+#define IDLE_LPM_BITS       LPM3_bits
+#endif
+
+// Function Prototypes
+//--------------------
+void InitProfiler(void);
+void ProfileReset(void);
+void ProfileBegin(void);
+void ProfileEnd(void);
+void ProfileDump(void);
+void CallInProfilerISR(void);
+
+#endif /* PROFILE_H_ */
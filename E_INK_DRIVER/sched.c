@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: sched.c
+//                  Cooperative task scheduler (protothreads)
+//                          Author: Sonikku
+//
+//              Tasks (see sched.h) are run in turn, each until it waits. When none of them yielded and no event came
+//              in meanwhile the CPU sleeps; any interrupt that leaves the low power mode on exit starts the next pass,
+//              and each task looks at whatever it is waiting for again. A task tests its condition with interrupts
+//              on, so an interrupt that ends a wait must post an event as well: one that only left the low power
+//              mode before the sleep started would be lost, and the CPU would sleep until something else happened.
+//              The ISRs in main.c post these:
+//
+//              BUSY edge (EVENT_FRAME_DONE)        - PT_WAIT_UNTIL(pt, DisplayBusy() == 0)
+//              Timer0_A CCR1 (EVENT_TIMER)         - PT_WAIT_UNTIL(pt, TimerWait(deadline))
+//              USCI_B0 idle (EVENT_TX_IDLE)        - PT_WAIT_UNTIL(pt, TransportBusy() == 0)
+//              Posted events (input.c)             - PT_WAIT_UNTIL(pt, (events & EVENT_...) != 0)
+//
+//              Events are handed to every task in the pass after they were posted, and are gone after it.
+//              The sleep is LPM3, or LPM0 while the USCI_B0 transport still has bytes to send (it runs from SMCLK).
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "sched.h"
+#include "input.h"
+#include "spi_transport.h"
+#include "profile.h"
+
+
+//------------------------------------------------------------------------
+// Name: RunTasks
+// Function: Run the tasks for ever
+// Arguments: Task table, resume points (one per task, cleared here), number of tasks
+// Returns: Never
+//------------------------------------------------------------------------
+void RunTasks(const TaskFunction *tasks, PT *state, unsigned char count){
+
+    unsigned char n;
+    unsigned char again;
+    unsigned char events = 0;
+
+    for (n = 0; n < count; n++){
+        state[n] = 0;
+    }
+
+    for (;;){
+        again = 0;
+        for (n = 0; n < count; n++){
+            if (tasks[n](&state[n], events) == PT_YIELDED){
+                again = 1;
+            }
+        }
+
+        __disable_interrupt();
+        // Test with interrupts off, so an event can't sneak in between the test and the sleep. A wake up without an
+        // event between a task's own test and here would be lost (see above)
+        events = TakeEvents();
+        if ((again == 0) && (events == 0)){
+            if (TransportBusy() != 0){
+                __bis_SR_register(LPM0_bits | GIE);         // Sleep; GIE is set in the same instruction
+            } else {
+                __bis_SR_register(IDLE_LPM_BITS | GIE);
+            }
+            __disable_interrupt();
+            events = TakeEvents();
+        }
+        __enable_interrupt();
+    }
+}
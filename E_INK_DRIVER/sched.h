@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for sched.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+// Protothreads: a task is a function that returns wherever it has to wait and carries on from the same place the
+// next time it is run. The only RAM a task needs is its resume point (one byte). Locals are lost at every wait -
+// keep what must survive in statics - and a switch() must not span a wait (the macros are one big switch)
+//
+//  static unsigned char BlinkTask(PT *pt, unsigned char events){
+//      static unsigned int deadline;
+//      PT_BEGIN(pt);
+//      P1OUT ^= LED1;
+//      deadline = TimerDeadline(500);
+//      PT_WAIT_UNTIL(pt, TimerWait(deadline));
+//      PT_END(pt);                             // Starts again at PT_BEGIN the next time
+//  }
+//
+// Resume points are line numbers folded to 1..255: two waits in one task 255 lines apart would give a duplicate
+// case label, which the compiler reports
+//
+// Only tasks yield. The waits inside the driver still block the scheduler until they are over: WaitBusy (DisplayFrame,
+// the PollBusy after SetLocation and RunSequence, a command sent while a refresh runs, the first ShowImage after reset,
+// ScrollDisplay), Delay (the reset pulse in InitDisplay) and the row streaming of every upload. The CPU sleeps in
+// them and interrupts still run, so S2 presses are kept as events, only handled late. A task keeps the scheduler free
+// by starting refreshes with ShowImage / StartDisplayFrame and waiting with PT_WAIT_UNTIL(pt, DisplayBusy() == 0)
+// before the next upload (DisplayTask in main.c), and by timing with TimerDeadline / TimerWait instead of Delay.
+//
+// Stack: the scheduler adds no stack per task, but the driver runs on top of it. Worst case in the default build,
+// worked out from the frames (return address + registers saved) as no call graph tool runs here:
+//      _c_int00 -> main                                     2
+//      RunTasks                                            14
+//      DisplayTask                                          6
+//      ShowPackedImage -> ShowContent                   2 + 8
+//      DisplayFrame -> PollBusy -> WaitBusy         2 + 2 + 6
+//      StartAlarm + 32 bit multiply                    6 + 6
+//      PORT1 ISR: PC, SR, R12 - R15                        12
+//      CallInInputISR + TimerRate + multiply               10     (CallInBusyISR -> FrameComplete -> FrameDone: 8)
+//                                                  total   76
+// The upload path (ShowContent -> LoadPackedBitmap 16 -> StreamData -> TransportWrite 4) comes to 74 with the same
+// ISR on top. The Timer0_A and USCI ISRs are smaller and interrupts don't nest. 80 bytes are reserved (.cproject)
+
+typedef unsigned char PT;                                       // Resume point, 0 = start
+typedef unsigned char (*TaskFunction)(PT *pt, unsigned char events);
+
+// Task return values
+#define PT_WAITING          0                   // Blocked, the scheduler may sleep
+#define PT_YIELDED          1                   // Wants to run again at once
+#define PT_ENDED            2
+
+#define PT_LINE                 ((__LINE__ % 255) + 1)
+#define PT_BEGIN(pt)            switch (*(pt)){ case 0:
+#define PT_WAIT_UNTIL(pt, cond) *(pt) = PT_LINE; case PT_LINE: if (!(cond)){ return PT_WAITING; }
+#define PT_YIELD(pt)            *(pt) = PT_LINE; return PT_YIELDED; case PT_LINE:
+#define PT_END(pt)              } *(pt) = 0; return PT_ENDED
+
+// Function Prototypes
+//--------------------
+void RunTasks(const TaskFunction *tasks, PT *state, unsigned char count);
+
+#endif /* SCHED_H_ */
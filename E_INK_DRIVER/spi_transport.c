@@ -0,0 +1,333 @@
+//---------------------------------------------------------------------------------------------------------------------------
+//
+//                      Name: spi_transport.c
+//                  Byte transport between the MSP430 and the e-ink controller
+//                          Author: Sonikku
+//
+//              Two backends, chosen in spi_transport.h:
+//              GPIO    - the original bit-banged interface, 8 read-modify-write cycles on P2OUT per bit
+//              USCI_B0 - hardware SPI master clocked from SMCLK, one TXBUF write per byte
+//
+//              Note that the USCI_B0 pins are fixed by the silicon (P1.5 = UCB0CLK, P1.7 = UCB0SIMO) so CS has to move
+//              from P1.5 to P2.0 when the hardware backend is used. P1.6 (UCB0SOMI / LED2) is left alone - the panel is
+//              write only.
+//
+//              TransportWriteBlock() hands a whole block to the USCI TX interrupt and returns at once, so the caller can
+//              get on with the next block (see RenderDisplayList). With the GPIO backend it simply sends the block.
+//
+//              The transport also owns D/C. TransportQueue() puts a byte tagged as command or data into a small ring
+//              that the TX interrupt drains, setting D/C for each byte once the one before has left the shifter, so
+//              WriteCommand()/WriteData() return without waiting for the wire. A block always goes out before ring
+//              bytes queued after it. CS stays LOW while anything is queued; TransportFlush() is the fence that
+//              waits for everything to be sent - use it before BUSY is looked at or the pins are touched directly.
+//---------------------------------------------------------------------------------------------------------------------------
+
+#include <msp430.h>
+#include "spi_transport.h"
+
+
+// Definitions on GPIO pins for the serial interface
+//---------------------------------------------------
+#ifdef SPI_TRANSPORT_USCI_B0
+#define CS  BIT0                // P2.0 as output
+#define CS_OUT P2OUT
+#define CS_DIR P2DIR
+#define UCB0_CLK BIT5           // P1.5 as UCB0CLK
+#define UCB0_SIMO BIT7          // P1.7 as UCB0SIMO
+#endif
+
+#ifdef SPI_TRANSPORT_GPIO
+#define CS  BIT5                // P1.5 as output
+#define CS_OUT P1OUT
+#define CS_DIR P1DIR
+#define CLK BIT0                // P2.0 as output
+#define DATA BIT1               // P2.1 as output
+#endif
+
+#define D_C BIT4                // P1.4 as output (Data/Command)
+
+#ifdef SPI_TRANSPORT_USCI_B0
+// Everything here is shared with the TX interrupt, so all of it is volatile: otherwise the optimiser may move a
+// store to the block or the ring past the IE2 write that lets the interrupt see it
+
+// Block being sent from the TX interrupt (TransportWriteBlock splits longer blocks into pieces of 255 bytes at most)
+const unsigned char * volatile block_src;
+volatile unsigned char block_count;
+volatile unsigned char block_mask;
+
+// Tagged byte ring, also drained by the TX interrupt. Only changed with UCB0TXIE clear (or in the interrupt)
+volatile unsigned char tx_ring[TX_RING_SIZE];
+volatile unsigned char tx_state;                // TX_DATA_SLOT(n) | TX_TAIL | slots in use x TX_ONE
+
+#define TX_DATA_SLOT(n)     (0x01 << (n))       // Bits 0-1: slot n holds data (else a command)
+#define TX_TAIL             0x04                // Next slot to send
+#define TX_TAIL_SLOT        ((tx_state >> 2) & 1)
+#define TX_ONE              0x08                // Bits 3-4: slots in use
+#define TX_USED             ((tx_state >> 3) & 3)
+#endif
+
+
+// Functions
+//-------------
+
+//---------------------------------------------------------------------
+// Name: InitTransport
+// Function: Configure the pins (and the USCI if selected) for the serial link
+// Parameters: void
+// Returns: void
+//---------------------------------------------------------------------
+void InitTransport(void){
+
+    CS_OUT |= CS;               // CHIP SELECT HIGH (inactive state)
+    CS_DIR |= CS;
+    P1OUT &= ~D_C;              // DATA/COMMAND pin LOW
+
+#ifdef SPI_TRANSPORT_USCI_B0
+    UCB0CTL1 = UCSWRST;                                 // Hold USCI in reset while configuring
+    UCB0CTL0 = UCCKPH | UCMSB | UCMST | UCSYNC;         // Mode 0 (capture on rising edge, idle low), MSB first, 3-pin master
+    UCB0CTL1 |= UCSSEL_2;                               // Clock from SMCLK
+    UCB0BR0 = 1;                                        // SPI clock = SMCLK / 1 = 2 MHz
+    UCB0BR1 = 0;
+    P1SEL |= UCB0_CLK | UCB0_SIMO;
+    P1SEL2 |= UCB0_CLK | UCB0_SIMO;
+    UCB0CTL1 &= ~UCSWRST;                               // Release USCI
+#endif
+
+#ifdef SPI_TRANSPORT_GPIO
+    P2OUT &= ~CLK;              // CLK LOW
+    P2OUT &= ~DATA;             // DATA LOW
+#endif
+
+}
+
+//---------------------------------------------------------------------
+// Name: TransportSelect
+// Function: Assert CS (active LOW)
+//---------------------------------------------------------------------
+void TransportSelect(void){
+    CS_OUT &= ~CS;
+}
+
+//---------------------------------------------------------------------
+// Name: TransportDeselect
+// Function: Wait for the last byte to leave the shifter, then release CS
+//---------------------------------------------------------------------
+void TransportDeselect(void){
+    TransportFlush();
+    CS_OUT |= CS;
+}
+
+//---------------------------------------------------------------------
+// Name: TransportFlush
+// Function: Block until every queued bit has been clocked out
+//           Must be called before CS or D/C are changed
+//---------------------------------------------------------------------
+void TransportFlush(void){
+#ifdef SPI_TRANSPORT_USCI_B0
+    while ((block_count != 0) || (TX_USED != 0)){
+        ;
+    }
+    while ((UCB0STAT & UCBUSY) != 0){
+        ;
+    }
+#endif
+}
+
+//---------------------------------------------------------------------
+// Name: TransportWrite
+// Function: Shift one byte out, MSB first. CS is not touched
+// Parameter: Data to be sent
+//---------------------------------------------------------------------
+void TransportWrite(unsigned char data){
+
+#ifdef SPI_TRANSPORT_USCI_B0
+    while ((block_count != 0) || (TX_USED != 0)){      // Keep the byte order if anything is still queued
+        ;
+    }
+    // TXBUF is double buffered, so the next byte can be loaded while the previous one is still shifting
+    while ((IFG2 & UCB0TXIFG) == 0){
+        ;
+    }
+    UCB0TXBUF = data;
+#endif
+
+#ifdef SPI_TRANSPORT_GPIO
+    unsigned char dout;
+    unsigned char n;
+    dout = data;
+    for (n = 0; n < 8; n++){
+
+        // Copy MSB of data to port PIN
+        if ((dout & 0x80) == 0x80){
+            P2OUT |= DATA;
+        } else {
+            P2OUT &= ~DATA;
+        }
+        dout = dout << 1;
+        // Clock the bit
+        P2OUT |= CLK;
+        P2OUT &= ~CLK;
+    }
+#endif
+
+}
+
+//---------------------------------------------------------------------
+// Name: TransportWriteBlock
+// Function: Send a block of bytes, each XORed with a mask. CS is not touched
+//           USCI: waits for the previous block, starts this one from the TX interrupt and returns at once
+//           (blocks over 255 bytes: once the last 255 are left). The source must stay unchanged until
+//           TransportBusy() returns 0
+//           GPIO: sends the block before returning
+// Parameters: Source data, byte count, XOR mask
+//---------------------------------------------------------------------
+void TransportWriteBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask){
+
+#ifdef SPI_TRANSPORT_USCI_B0
+    unsigned char piece;
+
+    while (len != 0){
+        // The count is 8 bits: the odd piece goes first, so it is a whole 255 bytes that is left to the interrupt
+        piece = len % 255;
+        if (piece == 0){
+            piece = 255;
+        }
+        while ((block_count != 0) || (TX_USED != 0)){
+            ;
+        }
+        if ((P1OUT & D_C) == 0){                        // A block is always data
+            TransportSetDC(TX_DATA);
+        }
+        block_src = src;
+        block_mask = xor_mask;
+        block_count = piece;
+        IE2 |= UCB0TXIE;                                // TXIFG is already set, so the first byte goes at once
+        src += piece;
+        len -= piece;
+    }
+#endif
+
+#ifdef SPI_TRANSPORT_GPIO
+    while (len != 0){
+        TransportWrite(*src ^ xor_mask);
+        src++;
+        len--;
+    }
+#endif
+
+}
+
+//---------------------------------------------------------------------
+// Name: TransportQueue
+// Function: Send a byte tagged as command or data. CS is lowered if needed
+//           USCI: the byte is put in the ring and sent from the TX interrupt, this only waits if the ring is full
+//           GPIO: sets D/C and sends the byte framed by CS, as before
+// Parameters: Byte, TX_COMMAND or TX_DATA
+//---------------------------------------------------------------------
+void TransportQueue(unsigned char data, unsigned char tag){
+
+#ifdef SPI_TRANSPORT_USCI_B0
+    unsigned char slot;
+
+    while (TX_USED == TX_RING_SIZE){
+        ;
+    }
+
+    IE2 &= ~UCB0TXIE;                                   // Keep the ISR off the ring while a slot is added
+    slot = (TX_TAIL_SLOT + TX_USED) & (TX_RING_SIZE - 1);
+    tx_ring[slot] = data;
+    if (tag == TX_DATA){
+        tx_state |= TX_DATA_SLOT(slot);
+    } else {
+        tx_state &= ~TX_DATA_SLOT(slot);
+    }
+    tx_state += TX_ONE;
+    CS_OUT &= ~CS;
+    IE2 |= UCB0TXIE;
+#endif
+
+#ifdef SPI_TRANSPORT_GPIO
+    if (tag == TX_DATA){
+        P1OUT |= D_C;
+    } else {
+        P1OUT &= ~D_C;
+    }
+    TransportSelect();
+    TransportWrite(data);
+    TransportDeselect();
+#endif
+
+}
+
+//---------------------------------------------------------------------
+// Name: TransportSetDC
+// Function: Fence, then set the D/C pin for bytes sent with TransportWrite()
+// Parameters: TX_COMMAND or TX_DATA
+//---------------------------------------------------------------------
+void TransportSetDC(unsigned char tag){
+
+    TransportFlush();
+    if (tag == TX_DATA){
+        P1OUT |= D_C;
+    } else {
+        P1OUT &= ~D_C;
+    }
+
+}
+
+//---------------------------------------------------------------------
+// Name: TransportBusy
+// Function: Check whether a block from TransportWriteBlock (or a queued byte) is still being sent
+// Returns: 1 = busy, 0 = done
+//---------------------------------------------------------------------
+unsigned char TransportBusy(void){
+
+#ifdef SPI_TRANSPORT_USCI_B0
+    return ((block_count != 0) || (TX_USED != 0));
+#else
+    return 0;
+#endif
+
+}
+
+//---------------------------------------------------------------------
+// Name: CallInTransportISR
+// Function: Load the next byte of the current block, or else of the ring, called from the USCI TX interrupt
+//           The vector is shared with USCI_A0, so only act when the B0 interrupt is ours
+// Returns: 1 when the last byte has been loaded and the CPU must leave LPM0, else 0
+//---------------------------------------------------------------------
+unsigned char CallInTransportISR(void){
+
+#ifdef SPI_TRANSPORT_USCI_B0
+    unsigned char slot;
+    unsigned char dc;
+
+    if (((IE2 & UCB0TXIE) == 0) || ((IFG2 & UCB0TXIFG) == 0)){
+        return 0;
+    }
+
+    if (block_count != 0){
+        UCB0TXBUF = *block_src ^ block_mask;
+        block_src++;
+        block_count--;
+    } else if (TX_USED != 0){
+        slot = TX_TAIL_SLOT;
+        dc = ((tx_state & TX_DATA_SLOT(slot)) != 0) ? D_C : 0;
+        if ((P1OUT & D_C) != dc){
+            while ((UCB0STAT & UCBUSY) != 0){           // D/C is sampled with the last bit of the previous byte
+                ;
+            }
+            P1OUT ^= D_C;
+        }
+        UCB0TXBUF = tx_ring[slot];
+        tx_state = (tx_state ^ TX_TAIL) - TX_ONE;
+    }
+
+    if ((block_count == 0) && (TX_USED == 0)){
+        IE2 &= ~UCB0TXIE;
+        return 1;
+    }
+#endif
+    return 0;
+
+}
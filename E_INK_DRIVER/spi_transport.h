@@ -0,0 +1,50 @@
+//-------------------------------------------------------------------------------------------------------
+//                      Header for spi_transport.c
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef SPI_TRANSPORT_H_
+#define SPI_TRANSPORT_H_
+
+// Transport selection (build time - define exactly one)
+//------------------------------------------------------
+#define SPI_TRANSPORT_GPIO                  // Bit-banged: CLK on P2.0, DATA on P2.1, CS on P1.5 (original wiring)
+//#define SPI_TRANSPORT_USCI_B0             // Hardware SPI: UCB0CLK on P1.5, UCB0SIMO on P1.7, CS moved to P2.0
+
+
+#if defined(SPI_TRANSPORT_GPIO) && defined(SPI_TRANSPORT_USCI_B0)
+#error "Select only one SPI transport"
+#endif
+
+#if !defined(SPI_TRANSPORT_GPIO) && !defined(SPI_TRANSPORT_USCI_B0)
+#error "No SPI transport selected"
+#endif
+
+// Byte tags for TransportQueue (level of the D/C pin)
+#define TX_COMMAND  0
+#define TX_DATA     1
+
+// USCI_B0 transmit ring: commands and their parameters are queued and sent from the TX interrupt
+// Two slots, plus the double buffered TXBUF that is a command and two parameters before anyone waits. The tags, next
+// slot and count share one byte laid out for 2 slots (spi_transport.c). Ring and block state cost 7 bytes of RAM
+#define TX_RING_SIZE 2
+
+#if TX_RING_SIZE != 2
+#error "The TX ring state byte is laid out for 2 slots"
+#endif
+
+
+// Function Prototypes
+//--------------------
+void InitTransport(void);
+void TransportSelect(void);
+void TransportDeselect(void);
+void TransportWrite(unsigned char data);
+void TransportFlush(void);
+void TransportQueue(unsigned char data, unsigned char tag);
+void TransportSetDC(unsigned char tag);
+void TransportWriteBlock(const unsigned char *src, unsigned int len, unsigned char xor_mask);
+unsigned char TransportBusy(void);
+unsigned char CallInTransportISR(void);
+
+
+#endif /* SPI_TRANSPORT_H_ */
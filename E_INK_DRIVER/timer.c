@@ -1,67 +1,297 @@
 //----------------------------------------------------------------------------------------------------------------
-//                 timer.c - general purpose delay timer function derived from a timer interrupt
+//                 timer.c - general purpose delay timer functions on one-shot Timer0_A compares
 //
 //                  Created on: 09 Aug 2020
 //                  Author: jasonmitchell
 //----------------------------------------------------------------------------------------------------------------
 #include <msp430.h>
 #include "timer.h"
+#include "profile.h"
+#include "clock.h"
+#include "spi_transport.h"
 
 
 
-unsigned int TIMERCOUNT;
+unsigned char timer_rate;                      // Timebase ticks per ms x 64, measured by CalibrateTimer()
+volatile unsigned char timer_flags;            // Set by the Timer0_A ISRs, single bit set / clear instructions only
+
+#define TIMER_ALARM_EXPIRED 0x01
+#define TIMER_DELAY_EXPIRED 0x02
 
 
 
 //------------------------------------------------------------------------
-// Name: Delay
-// Function: Generate specified delay
-// Arguments: Delay in milli-seconds between 0 and 65535
-// Returns: void
+// Name: ReadTimerA0
+// Function: Read TA0R safely - the timer runs from ACLK, asynchronous to MCLK,
+//           so read until two consecutive values agree
+// Arguments: void
+// Returns: Timer count
 //------------------------------------------------------------------------
-void Delay(unsigned int delay){
+static unsigned int ReadTimerA0(void){
+    unsigned int t1;
+    unsigned int t2;
+
+    t2 = TA0R;
+    do {
+        t1 = t2;
+        t2 = TA0R;
+    } while (t1 != t2);
+
+    return t1;
+}
+
+//------------------------------------------------------------------------
+// Name: MsToTicks
+// Function: Convert milli-seconds to timebase ticks, rounded up so a wait is never short
+// Arguments: Milli-seconds
+// Returns: Ticks
+//------------------------------------------------------------------------
+static unsigned long MsToTicks(unsigned int ms){
+    return (((unsigned long)ms * timer_rate) + 63) >> 6;
+}
 
-    unsigned int user_delay;
+//------------------------------------------------------------------------
+// Name: CalibrateTimer
+// Function: Measure the VLO against SMCLK: Timer0_A counts SMCLK and CCR0 captures the rising edges of ACLK
+//           (CCI0B) over TIMER_CAL_PERIODS periods. Keeps the nominal rate if ACLK never toggles or the result
+//           is out of the VLO range
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+static void CalibrateTimer(void){
+    unsigned int first = 0;
+    unsigned int last = 0;
+    unsigned int guard;
+    unsigned char n;
+    unsigned long rate;
 
+    timer_rate = TIMER_RATE_NOMINAL;
 
-    user_delay = delay * 2;
-    TIMERCOUNT = 0;
+    TA0CTL = TASSEL_2 | ID_0 | MC_2 | TACLR;    // SMCLK / 1, continuous mode
+    TA0CCTL0 = CM_1 | CCIS_1 | SCS | CAP;       // Capture ACLK rising edges, synchronised
 
-    for(;;){
-        if (TIMERCOUNT >= user_delay){
-            return;
+    for (n = 0; n <= TIMER_CAL_PERIODS; n++){
+        guard = 0xFFFF;
+        while ((TA0CCTL0 & CCIFG) == 0){
+            guard--;
+            if (guard == 0){
+                TA0CCTL0 = 0;
+                return;                         // No ACLK
+            }
+        }
+        last = TA0CCR0;
+        TA0CCTL0 &= ~CCIFG;
+        if (n == 0){
+            first = last;
         }
     }
+    TA0CCTL0 = 0;
 
+    if (last == first){
+        return;
+    }
+    rate = ((CLOCK_SMCLK_HZ / 1000UL) * (TIMER_CAL_PERIODS * 8UL)) / (unsigned int)(last - first);
+    if ((rate >= 32) && (rate <= 160)){         // 4 to 20 kHz
+        timer_rate = (unsigned char)rate;
+    }
 }
 
-
+//------------------------------------------------------------------------
 // Name: InitTimerSystem
-// Function: Initialise the timer system e.g. clear variables
+// Function: Initialise the timer system: start the VLO, measure it and start the Timer0_A timebase
+//           Nothing is armed afterwards, so the timer raises no interrupts until Delay() or StartAlarm()
 // Arguments: void
 // Returns: void
 //------------------------------------------------------------------------
 void InitTimerSystem(void){
-    TIMERCOUNT = 0;
+    timer_flags = 0;
+
+    BCSCTL3 |= LFXT1S_2;                        // ACLK from VLO - no crystal needed
+    CalibrateTimer();
+    TA0CTL = TASSEL_1 | ID_3 | MC_2 | TACLR;    // Timer0_A: ACLK / 8, continuous mode
 }
 
-// Name: CallInISR
-// Function: Call this in the timer ISR, so that it drives our timers here
-// Arguments: void
+//------------------------------------------------------------------------
+// Name: Delay
+// Function: Generate specified delay, asleep in LPM3 until a one-shot compare on Timer0_A CCR1
+//           Longer delays than one compare are made of several, each deadline counted from the last
+//           one so no time is lost in between. Don't call from an ISR
+//           A TimerWait deadline armed on CCR1 is put back afterwards (interrupting at once if it passed meanwhile)
+//           Bytes still queued on the transport are sent first: SMCLK, and with it USCI_B0, stops in LPM3
+// Arguments: Delay in milli-seconds between 0 and 65535
 // Returns: void
 //------------------------------------------------------------------------
-void CallInISR(void){
+void Delay(unsigned int delay){
+
+    unsigned long remaining;
+    unsigned int chunk;
+    unsigned int deadline;
+    unsigned int wake;
+    unsigned int wake_armed;
+
+    wake = TA0CCR1;
+    wake_armed = TA0CCTL1 & CCIE;
+
+    remaining = MsToTicks(delay);
+    if (remaining == 1){
+        remaining = 2;                          // A compare one tick ahead could be passed before it is armed
+    }
+    TransportFlush();                           // Don't freeze a byte half shifted out (CS stays as it is)
+    deadline = ReadTimerA0();
+
+    while (remaining != 0){
+        chunk = TIMER_MAX_TICKS;
+        if (remaining < TIMER_MAX_TICKS){
+            chunk = (unsigned int)remaining;
+        }
+        remaining -= chunk;
+        deadline += chunk;
+
+        timer_flags &= ~TIMER_DELAY_EXPIRED;
+        TA0CCR1 = deadline;
+        TA0CCTL1 = CCIE;                        // Clear CCIFG, enable compare interrupt
+
+        for (;;){
+            __disable_interrupt();
+            // Test with interrupts off, so the compare can't sneak in between the test and the sleep
+            if ((timer_flags & TIMER_DELAY_EXPIRED) != 0){
+                break;
+            }
+            __bis_SR_register(IDLE_LPM_BITS | GIE); // Sleep; GIE is set in the same instruction
+        }
+        __enable_interrupt();
+    }
+
+    if (wake_armed != 0){
+        TA0CCR1 = wake;
+        if ((int)(wake - ReadTimerA0()) < 2){
+            TA0CCTL1 = CCIE | CCIFG;            // Missed while we slept, interrupt now
+        } else {
+            TA0CCTL1 = CCIE;
+        }
+    }
+
+}
+
+//------------------------------------------------------------------------
+// Name: TimerDeadline
+// Function: Time stamp some milli-seconds ahead, for TimerWait
+// Arguments: Milli-seconds (clamped to TIMER_MAX_WAIT ticks, ~21 s at 12 kHz)
+// Returns: Deadline in timebase ticks
+//------------------------------------------------------------------------
+unsigned int TimerDeadline(unsigned int ms){
+
+    unsigned long ticks;
+
+    ticks = MsToTicks(ms);
+    if (ticks > TIMER_MAX_WAIT){
+        ticks = TIMER_MAX_WAIT;
+    }
+    return ReadTimerA0() + (unsigned int)ticks;
+}
 
-    TIMERCOUNT++;
-    TIME_MEASURE++;
+//------------------------------------------------------------------------
+// Name: TimerWait
+// Function: Non blocking wait for a deadline (scheduler tasks). While it hasn't come, the CCR1 compare is armed for
+//           it - or left at an earlier deadline armed by someone else - so the CPU is woken in time
+// Arguments: Deadline from TimerDeadline
+// Returns: 1 once the deadline is less than two ticks away (too close to arm), else 0
+//------------------------------------------------------------------------
+unsigned char TimerWait(unsigned int deadline){
+
+    if ((int)(deadline - ReadTimerA0()) < 2){
+        return 1;
+    }
+    if (((TA0CCTL1 & CCIE) == 0) || ((int)(deadline - TA0CCR1) < 0)){
+        timer_flags &= ~TIMER_DELAY_EXPIRED;
+        TA0CCR1 = deadline;
+        TA0CCTL1 = CCIE;                        // Clear CCIFG, enable compare interrupt
+    }
+    return 0;
+}
 
+//------------------------------------------------------------------------
+// Name: TimerTicks
+// Function: Free running timebase count, for measuring intervals (see TimerRate)
+// Arguments: void
+// Returns: Ticks (wraps every 65536)
+//------------------------------------------------------------------------
+unsigned int TimerTicks(void){
+    return ReadTimerA0();
+}
 
+//------------------------------------------------------------------------
+// Name: TimerRate
+// Function: Timebase rate measured at start up
+// Arguments: void
+// Returns: Ticks per ms x 64
+//------------------------------------------------------------------------
+unsigned char TimerRate(void){
+    return timer_rate;
 }
 
+//------------------------------------------------------------------------
+// Name: StartAlarm
+// Function: Arm a one-shot alarm on Timer0_A CCR0. The ISR wakes the CPU from LPM3
+// Arguments: Alarm period in milli-seconds (clamped to TIMER_MAX_TICKS, ~43 s at 12 kHz). Accuracy is that of the
+//            VLO calibration
+// Returns: void
+//------------------------------------------------------------------------
+void StartAlarm(unsigned int ms){
 
+    unsigned long ticks;
 
+    ticks = MsToTicks(ms);
+    if (ticks > TIMER_MAX_TICKS){
+        ticks = TIMER_MAX_TICKS;
+    }
+    if (ticks < 2){
+        ticks = 2;                              // See Delay
+    }
 
+    timer_flags &= ~TIMER_ALARM_EXPIRED;
+    TA0CCR0 = ReadTimerA0() + (unsigned int)ticks;
+    TA0CCTL0 = CCIE;                            // Clear CCIFG, enable compare interrupt
+}
 
+//------------------------------------------------------------------------
+// Name: StopAlarm
+// Function: Disarm the alarm
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void StopAlarm(void){
+    TA0CCTL0 = 0;
+}
 
+//------------------------------------------------------------------------
+// Name: AlarmExpired
+// Function: Report whether the last alarm has fired
+// Arguments: void
+// Returns: 1 = expired, 0 = still running (or never armed)
+//------------------------------------------------------------------------
+unsigned char AlarmExpired(void){
+    return (timer_flags & TIMER_ALARM_EXPIRED) != 0;
+}
 
+//------------------------------------------------------------------------
+// Name: CallInAlarmISR
+// Function: Call this in the Timer0_A CCR0 ISR
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void CallInAlarmISR(void){
+    TA0CCTL0 = 0;                               // One-shot
+    timer_flags |= TIMER_ALARM_EXPIRED;
+}
 
+//------------------------------------------------------------------------
+// Name: CallInDelayISR
+// Function: Call this in the Timer0_A TA0IV ISR for CCR1 (the Delay() deadline), then leave LPM3
+// Arguments: void
+// Returns: void
+//------------------------------------------------------------------------
+void CallInDelayISR(void){
+    TA0CCTL1 = 0;                               // One-shot
+    timer_flags |= TIMER_DELAY_EXPIRED;
+}
@@ -6,13 +6,28 @@
 // Definitions
 //--------------------
 
-unsigned int TIME_MEASURE;
+// Timebase: Timer0_A in continuous mode from ACLK = VLO (~12 kHz) / 8, nothing ticks periodically
+// Keeps running in LPM3. CCR0 is the alarm (timeouts), CCR1 the Delay() deadline: both one-shot compares
+// The VLO is measured against SMCLK (CLOCK_SMCLK_HZ, clock.h) at start up (it may be anywhere from 4 to 20 kHz)
+// Nothing here depends on MCLK, so Delay() and the alarm keep time across ClockFast() / ClockSlow()
+#define TIMER_RATE_NOMINAL      96          // Timebase ticks per ms x 64 at 12 kHz (1.5 ticks per ms)
+#define TIMER_CAL_PERIODS       8           // VLO periods counted by the calibration
+#define TIMER_MAX_TICKS         0xFF00      // Longest single compare, kept clear of a full timer wrap
+#define TIMER_MAX_WAIT          0x7F00      // Longest TimerWait deadline, deadlines are compared as signed differences
 
 // Function Prototypes
 //--------------------
 void Delay(unsigned int delay);
 void InitTimerSystem(void);
-void CallInISR(void);
+unsigned int TimerDeadline(unsigned int ms);
+unsigned char TimerWait(unsigned int deadline);
+unsigned int TimerTicks(void);
+unsigned char TimerRate(void);
+void CallInDelayISR(void);
+void StartAlarm(unsigned int ms);
+void StopAlarm(void);
+unsigned char AlarmExpired(void);
+void CallInAlarmISR(void);
 
 
 